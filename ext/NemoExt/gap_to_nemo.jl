@@ -50,16 +50,59 @@ function __ensure_gap_matrix(obj::GapObj)
 end
 
 ##
-## matrix of GAP integers to `ZZMatrix`
+## batched conversion of matrices of GAP integers or rationals:
+## the limbs of all entries in a row are copied into one buffer at once
 ##
-function ZZMatrix(obj::GapObj)
+
+# Copy the limbs of the entries of the GAP list `row`, resp. of their
+# numerators or denominators, into `buf`, and store pointers to them in
+# `limbs` and their signed numbers in `sizes`.
+# Return `false` if the entries are not integers resp. rationals.
+function _row_limbs!(buf::Vector{UInt}, limbs::Vector{Ptr{UInt}}, sizes::Vector{Int}, row::GapObj, part::Int)
+  GAP.int_list_sizes!(sizes, row, part) || return false
+  total = sum(abs, sizes; init = 0)
+  length(buf) < total && resize!(buf, total)
+  GC.@preserve buf begin
+    p = pointer(buf)
+    for j in eachindex(sizes)
+      limbs[j] = p
+      p += abs(sizes[j]) * sizeof(UInt)
+    end
+    GAP.int_list_limbs!(limbs, row, part)
+  end
+  return true
+end
+
+# Set the (initially zero) `fmpz` at `z` to the integer with the limbs at `p`.
+function _set_from_limbs!(z::Ptr{ZZRingElem}, p::Ptr{UInt}, n::Int)
+  n == 0 && return
+  ccall((:fmpz_set_ui_array, Nemo.libflint), Cvoid, (Ptr{ZZRingElem}, Ptr{UInt}, Int), z, p, abs(n))
+  n < 0 && ccall((:fmpz_neg, Nemo.libflint), Cvoid, (Ptr{ZZRingElem}, Ptr{ZZRingElem}), z, z)
+  return
+end
+
+function _rows_for_conversion(obj::GapObj, T::Type)
   __ensure_gap_matrix(obj)
   nrows = Wrappers.NumberRows(obj)
   ncols = Wrappers.NumberColumns(obj)
+  return GAP._rows_list(obj, T), nrows, ncols
+end
+
+##
+## matrix of GAP integers to `ZZMatrix`
+##
+function ZZMatrix(obj::GapObj)
+  rows, nrows, ncols = _rows_for_conversion(obj, ZZMatrix)
   m = zero_matrix(ZZ, nrows, ncols)
-  for i in 1:nrows, j in 1:ncols
-    x = obj[i,j]
-    @inbounds m[i,j] = x isa Int ? x : ZZRingElem(x::GapObj)
+  buf = UInt[]
+  limbs = Vector{Ptr{UInt}}(undef, ncols)
+  sizes = Vector{Int}(undef, ncols)
+  for i in 1:nrows
+    row = rows[i]
+    row isa GapObj && _row_limbs!(buf, limbs, sizes, row, GAP._PART_INT) || throw(GAP.ConversionError(obj, ZZMatrix))
+    GC.@preserve buf m for j in 1:ncols
+      _set_from_limbs!(Nemo.mat_entry_ptr(m, i, j), limbs[j], sizes[j])
+    end
   end
   return m
 end
@@ -70,13 +113,25 @@ GAP.gap_to_julia_internal(::Type{ZZMatrix}, obj::GapObj, ::GAP.JuliaCacheDict, :
 ## matrix of GAP rationals or integers to `QQMatrix`
 ##
 function QQMatrix(obj::GapObj)
-  __ensure_gap_matrix(obj)
-  nrows = Wrappers.NumberRows(obj)
-  ncols = Wrappers.NumberColumns(obj)
+  rows, nrows, ncols = _rows_for_conversion(obj, QQMatrix)
   m = zero_matrix(QQ, nrows, ncols)
-  for i in 1:nrows, j in 1:ncols
-    x = obj[i,j]
-    @inbounds m[i,j] = x isa Int ? x : QQFieldElem(x::GapObj)
+  num_buf = UInt[]
+  den_buf = UInt[]
+  num_limbs = Vector{Ptr{UInt}}(undef, ncols)
+  den_limbs = Vector{Ptr{UInt}}(undef, ncols)
+  num_sizes = Vector{Int}(undef, ncols)
+  den_sizes = Vector{Int}(undef, ncols)
+  for i in 1:nrows
+    row = rows[i]
+    row isa GapObj &&
+      _row_limbs!(num_buf, num_limbs, num_sizes, row, GAP._PART_NUM) &&
+      _row_limbs!(den_buf, den_limbs, den_sizes, row, GAP._PART_DEN) ||
+      throw(GAP.ConversionError(obj, QQMatrix))
+    GC.@preserve num_buf den_buf m for j in 1:ncols
+      x = Nemo.mat_entry_ptr(m, i, j)
+      _set_from_limbs!(Nemo._num_ptr(x), num_limbs[j], num_sizes[j])
+      _set_from_limbs!(Nemo._den_ptr(x), den_limbs[j], den_sizes[j])
+    end
   end
   return m
 end
@@ -103,5 +158,36 @@ function matrix(R::Ring, obj::GapObj)
   return m
 end
 
+matrix(R::ZZRing, obj::GapObj) = ZZMatrix(obj)
+matrix(R::QQField, obj::GapObj) = QQMatrix(obj)
+
+##
+## matrix of FFEs to a matrix over a finite field with at most 65536 elements:
+## the rows are unpacked in the kernel, also for compressed matrices
+##
+function matrix(F::_FFEField, obj::GapObj)
+  _has_ffe_table(F) || return invoke(matrix, Tuple{Ring, GapObj}, F, obj)
+  __ensure_gap_matrix(obj)
+  nrows = Wrappers.NumberRows(obj)
+  ncols = Wrappers.NumberColumns(obj)
+  t = _ffe_table(F)
+  vals = GAP.ffe_matrix_values!(Matrix{UInt16}(undef, ncols, nrows), obj, t.p, t.d)
+  m = zero_matrix(F, nrows, ncols)
+  for i in 1:nrows, j in 1:ncols
+    v = vals[j, i]
+    v == 0 || (@inbounds m[i,j] = t.powers[v])
+  end
+  return m
+end
+
 # also allow map_entries to make Claus happy ;-)
 Nemo.map_entries(R::Ring, obj::GapObj) = matrix(R, obj)
+
+# for finite fields, `map_entries` also converts vectors of FFEs
+function Nemo.map_entries(F::_FFEField, obj::GapObj)
+  Wrappers.IsMatrixOrMatrixObj(obj) && return matrix(F, obj)
+  _has_ffe_table(F) || throw(GAP.ConversionError(obj, Vector{elem_type(F)}))
+  t = _ffe_table(F)
+  vals = GAP.ffe_vector_values!(Vector{UInt16}(undef, length(obj)), obj, t.p, t.d)
+  return [_ffe_element(F, t, v) for v in vals]
+end
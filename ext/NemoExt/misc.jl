@@ -13,3 +13,91 @@
 # characteristic directly from the GAP FFE
 characteristic(x::GAP.FFE) = ZZRingElem(Wrappers.CHAR_FFE_DEFAULT(x))
 characteristic(x::GapObj) = ZZRingElem(Wrappers.Characteristic(x))
+
+##
+## finite fields with at most 65536 elements:
+## correspondence between the elements of a Nemo field and GAP FFEs
+##
+
+const _FFEField = Union{fpField, FpField, FqField, fqPolyRepField}
+const _FFEFieldElem = Union{fpFieldElem, FpFieldElem, FqFieldElem, fqPolyRepFieldElem}
+const _FFEMatrix = Union{fpMatrix, FpMatrix, FqMatrix, fqPolyRepMatrix}
+
+_absolute_degree(F::Union{fpField, FpField}) = 1
+_absolute_degree(F::FqField) = Nemo.absolute_degree(F)
+_absolute_degree(F::fqPolyRepField) = Nemo.degree(F)
+
+# GAP represents the elements of GF(p^d) as immediate FFEs if p^d <= 65536,
+# the value of such an FFE is 0 for zero and k+1 for Z(p^d)^k
+_has_ffe_table(F::_FFEField) = characteristic(F)^_absolute_degree(F) <= 65536
+
+struct FFETable{T}
+  p::Int
+  d::Int
+  powers::Vector{T}          # `powers[k]` corresponds to `Z(p^d)^(k-1)`
+  logs::Vector{UInt16}       # the GAP values, indexed by `_coeff_code(x, p) + 1`
+  values::Dict{T, UInt16}    # the GAP values of the nonzero elements if `logs` is empty
+end
+
+const _ffe_tables = WeakKeyDict{Any, Any}()
+
+function _ffe_table(F::T) where T <: _FFEField
+  return get!(() -> _create_ffe_table(F), _ffe_tables, F)::FFETable{elem_type(T)}
+end
+
+# Return whether the elements of `F` can be identified by their
+# coefficients without constructing Nemo objects, see `_coeff_code`.
+_has_coeff_code(F::_FFEField) = _absolute_degree(F) == 1 || F isa fqPolyRepField
+
+function _create_ffe_table(F::_FFEField)
+  p = Int(characteristic(F))
+  d = _absolute_degree(F)
+  if d == 1
+    z = F(Int(GAP.Globals.IntFFE(GAP.Globals.Z(p))))
+  else
+    # map `Z(p^d)` to a root of the Conway polynomial in `F`,
+    # preferably to the generator of `F`
+    coeffs = Vector{Int}(GAP.Globals.IntVecFFE(GAP.Globals.CoefficientsOfUnivariatePolynomial(GAP.Globals.ConwayPolynomial(p, d))))
+    R, _ = polynomial_ring(F, :x; cached = false)
+    f = R(map(F, coeffs))
+    z = is_zero(f(gen(F))) ? gen(F) : first(roots(f))
+  end
+  q = p^d
+  powers = Vector{elem_type(F)}(undef, q - 1)
+  coded = _has_coeff_code(F)
+  logs = coded ? zeros(UInt16, q) : UInt16[]
+  values = Dict{elem_type(F), UInt16}()
+  coded || sizehint!(values, q - 1)
+  x = one(F)
+  for k in 1:(q - 1)
+    powers[k] = x
+    if coded
+      logs[_coeff_code(x, p) + 1] = k
+    else
+      values[x] = k
+    end
+    x = x * z
+  end
+  return FFETable(p, d, powers, logs, values)
+end
+
+# the integer in `0:p^d-1` whose base `p` digits are the coefficients of `x`,
+# for prime fields this is `lift(x)`
+_coeff_code(x::Union{fpFieldElem, FpFieldElem}, p::Int) = Int(lift(x))
+_coeff_code(x::FqFieldElem, p::Int) = Int(lift(ZZ, x))
+
+function _coeff_code(x::fqPolyRepFieldElem, p::Int)
+  c = 0
+  for k in Nemo.degree(parent(x))-1:-1:0
+    c = c * p + Int(coeff(x, k))
+  end
+  return c
+end
+
+function _ffe_value(t::FFETable, x)
+  isempty(t.logs) || return t.logs[_coeff_code(x, t.p) + 1]
+  return is_zero(x) ? UInt16(0) : t.values[x]
+end
+
+# the elements in `t.powers` are shared, thus return copies
+_ffe_element(F::_FFEField, t::FFETable, v::UInt16) = v == 0 ? zero(F) : deepcopy(t.powers[v])
@@ -63,24 +63,131 @@ function GAP.GapObj_internal(
     return ret_val
 end
 
-function GAP.GapObj_internal(obj::Union{ZZMatrix,QQMatrix}, ::GapCacheDict, ::Val)
+## matrices of integers and rationals:
+## the limbs of all entries in a row are handed over at once
+
+# Store a pointer to the limbs of the `fmpz` at `x` in `limbs[j]` and
+# their signed number in `sizes[j]`; small values are stored in `buf[j]`.
+function _fmpz_limbs!(limbs::Vector{Ptr{UInt}}, sizes::Vector{Int}, buf::Vector{UInt}, j::Int, x::Ptr{ZZRingElem})
+    if Nemo._fmpz_is_small(x)
+        v = data(x)
+        buf[j] = unsigned(abs(v))
+        sizes[j] = sign(v)
+        limbs[j] = pointer(buf, j)
+    else
+        b = Nemo._as_bigint(x)
+        limbs[j] = b.d
+        sizes[j] = b.size
+    end
+end
+
+function GAP.GapObj_internal(obj::ZZMatrix, ::GapCacheDict, ::Val)
     rows = nrows(obj)
     cols = ncols(obj)
     ret_val = GAP.NewPlist(rows)
 
-    for i = 1:rows
-        r = ret_val[i] = GAP.NewPlist(cols)
+    limbs = Vector{Ptr{UInt}}(undef, cols)
+    sizes = Vector{Int}(undef, cols)
+    buf = Vector{UInt}(undef, cols)
+    GC.@preserve obj buf for i = 1:rows
         for j = 1:cols
-            ptr = Nemo.mat_entry_ptr(obj, i, j)
-            y = GapObj(ptr)
-            r[j] = y
+            _fmpz_limbs!(limbs, sizes, buf, j, Nemo.mat_entry_ptr(obj, i, j))
+        end
+        ret_val[i] = GAP.rat_list_from_limbs(limbs, sizes, nothing, nothing)
+    end
+    return ret_val
+end
+
+function GAP.GapObj_internal(obj::QQMatrix, ::GapCacheDict, ::Val)
+    rows = nrows(obj)
+    cols = ncols(obj)
+    ret_val = GAP.NewPlist(rows)
+
+    num_limbs = Vector{Ptr{UInt}}(undef, cols)
+    den_limbs = Vector{Ptr{UInt}}(undef, cols)
+    num_sizes = Vector{Int}(undef, cols)
+    den_sizes = Vector{Int}(undef, cols)
+    num_buf = Vector{UInt}(undef, cols)
+    den_buf = Vector{UInt}(undef, cols)
+    GC.@preserve obj num_buf den_buf for i = 1:rows
+        for j = 1:cols
+            x = Nemo.mat_entry_ptr(obj, i, j)
+            _fmpz_limbs!(num_limbs, num_sizes, num_buf, j, Nemo._num_ptr(x))
+            _fmpz_limbs!(den_limbs, den_sizes, den_buf, j, Nemo._den_ptr(x))
         end
+        ret_val[i] = GAP.rat_list_from_limbs(num_limbs, num_sizes, den_limbs, den_sizes)
     end
     return ret_val
 end
 
-## matrix of elements of a finite field (of prime order)
-GAP.@install function GapObj(obj::Union{fpMatrix, FpMatrix})
-    e = GAP.Globals.Z(GapObj(characteristic(base_ring(obj))))
-    return GapObj(lift(obj)) * e
+## matrix of elements of a finite field,
+## compressed in GAP if the field has at most 256 elements
+GAP.@install function GapObj(obj::_FFEMatrix)
+    F = base_ring(obj)
+    if !_has_ffe_table(F)
+        # large prime fields: GAP's `Z(p)` is not an FFE
+        obj isa Union{fpMatrix, FpMatrix} || throw(GAP.ConversionError(obj, GapObj))
+        e = GAP.Globals.Z(GapObj(characteristic(F)))
+        return GapObj(lift(obj)) * e
+    end
+    t = _ffe_table(F)
+    vals = Matrix{UInt16}(undef, ncols(obj), nrows(obj))
+    _ffe_matrix_values!(vals, t, obj)
+    return GAP.ffe_matrix_from_values(vals, t.p, t.d)
+end
+
+# Store the GAP values of the entries of `obj` in the columns of `vals`.
+# The entries of `fpMatrix`, `FpMatrix`, and `fqPolyRepMatrix` objects are
+# read directly from the flint data, without creating Nemo elements.
+function _ffe_matrix_values!(vals::Matrix{UInt16}, t::FFETable, obj::fpMatrix)
+    GC.@preserve obj for i in 1:nrows(obj), j in 1:ncols(obj)
+        c = unsafe_load(ccall((:nmod_mat_entry_ptr, Nemo.libflint), Ptr{UInt}, (Ref{fpMatrix}, Int, Int), obj, i - 1, j - 1))
+        @inbounds vals[j, i] = t.logs[c + 1]
+    end
+    return vals
+end
+
+function _ffe_matrix_values!(vals::Matrix{UInt16}, t::FFETable, obj::FpMatrix)
+    # the entries are reduced modulo `p`, thus they are small `fmpz`s,
+    # which are stored as the values themselves
+    GC.@preserve obj for i in 1:nrows(obj), j in 1:ncols(obj)
+        c = unsafe_load(ccall((:fmpz_mod_mat_entry, Nemo.libflint), Ptr{Int}, (Ref{FpMatrix}, Int, Int), obj, i - 1, j - 1))
+        @inbounds vals[j, i] = t.logs[c + 1]
+    end
+    return vals
+end
+
+function _ffe_matrix_values!(vals::Matrix{UInt16}, t::FFETable, obj::fqPolyRepMatrix)
+    p = t.p
+    GC.@preserve obj for i in 1:nrows(obj), j in 1:ncols(obj)
+        # an `fq_nmod` is an `nmod_poly`, starting with the pointer to the
+        # coefficients, the number of allocated and of used coefficients
+        x = ccall((:fq_nmod_mat_entry, Nemo.libflint), Ptr{Int}, (Ref{fqPolyRepMatrix}, Int, Int), obj, i - 1, j - 1)
+        coeffs = unsafe_load(Ptr{Ptr{UInt}}(x))
+        c = 0
+        for k in unsafe_load(x, 3):-1:1
+            c = c * p + Int(unsafe_load(coeffs, k))
+        end
+        @inbounds vals[j, i] = t.logs[c + 1]
+    end
+    return vals
+end
+
+# `FqMatrix`: the layout of the entries depends on the flint context
+function _ffe_matrix_values!(vals::Matrix{UInt16}, t::FFETable, obj::FqMatrix)
+    for i in 1:nrows(obj), j in 1:ncols(obj)
+        @inbounds vals[j, i] = _ffe_value(t, obj[i, j])
+    end
+    return vals
+end
+
+## vector of elements of a finite field,
+## compressed in GAP if the field has at most 256 elements
+function GAP.GapObj_internal(obj::Vector{T}, ::GapCacheDict, ::Val) where T <: _FFEFieldElem
+    isempty(obj) && return GAP.NewPlist(0)
+    F = parent(obj[1])
+    _has_ffe_table(F) || throw(GAP.ConversionError(obj, GapObj))
+    t = _ffe_table(F)
+    vals = UInt16[_ffe_value(t, x) for x in obj]
+    return GAP.ffe_vector_from_values(vals, t.p, t.d)
 end
@@ -318,8 +318,43 @@ DeclareGlobalVariable( "Julia" );
 #! gap> res.value{ [ 1 .. Position( res.value, '(' )-1 ] };
 #! "MethodError"
 #! @EndExampleSession
+#!
+#!  If one is not interested in the error message then
+#!  <Ref Func="TryCallJuliaFunction"/> is cheaper.
 DeclareGlobalFunction( "CallJuliaFunctionWithCatch" );
 
+#! @Arguments juliafunc, arguments[, kwargs]
+#! @Returns a list of length two.
+#! @Description
+#!  The function calls the &Julia; function <A>juliafunc</A>
+#!  with ordinary arguments in the &GAP; list <A>arguments</A>
+#!  and optionally with keyword arguments given by the component names (keys)
+#!  and values of the &GAP; record <A>kwargs</A>,
+#!  like <Ref Func="CallJuliaFunctionWithCatch"/>.
+#!  If no error occurred then the result is <C>[ true, value ]</C>,
+#!  where <C>value</C> is the value returned by <A>juliafunc</A>.
+#!  If an error occurred then the result is <C>[ false, err ]</C>,
+#!  where <C>err</C> is a &Julia; object of type <C>GAP.JuliaError</C>
+#!  that stores the &Julia; exception and its backtrace.
+#!  The error message is not computed unless it is needed,
+#!  thus <Ref Func="TryCallJuliaFunction"/> is suitable for trying a
+#!  &Julia; function and falling back to other code if the call fails.
+#!  The message can be computed with <C>GAP_jl.error_message( err )</C>,
+#!  the exception object is <C>err.exception</C>.
+#! @BeginExampleSession
+#! gap> TryCallJuliaFunction( Julia.sqrt, [ 4 ] );
+#! [ true, <Julia: 2.0> ]
+#! gap> res:= TryCallJuliaFunction( Julia.sqrt, [ -1 ] );;
+#! gap> res[1];
+#! false
+#! gap> Julia.isa( res[2].exception, Julia.DomainError );
+#! true
+#! gap> msg:= JuliaToGAP( IsString, GAP_jl.error_message( res[2] ) );;
+#! gap> StartsWith( msg, "DomainError" );
+#! true
+#! @EndExampleSession
+DeclareGlobalFunction( "TryCallJuliaFunction" );
+
 #! @Arguments juliafunc, arguments, kwargs
 #! @Returns the result of the &Julia; function call.
 #! @Description
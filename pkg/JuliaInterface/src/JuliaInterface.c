@@ -14,6 +14,8 @@
 
 #include "calls.h"
 #include "convert.h"
+#include "ffe.h"
+#include "serialize.h"
 #include "sync.h"
 
 // With gap 4.15, the header julia_gc.h is available through gap_all.h.
@@ -24,11 +26,14 @@
 
 #include <julia_gcext.h>    // Julia header
 
+#include <stdlib.h>
+#include <string.h>
+
 jl_module_t * gap_module;
 
-static jl_value_t *    JULIA_ERROR_IOBuffer;
-static jl_value_t *    JULIA_FUNC_take_inplace;
-static jl_value_t *    JULIA_FUNC_showerror;
+static jl_value_t *    JULIA_FUNC_exception_message;
+static jl_value_t *    JULIA_FUNC_getproperty;
+static jl_value_t *    JULIA_FUNC_setproperty;
 static jl_datatype_t * JULIA_GAPFFE_type;
 
 static jl_datatype_t * gap_datatype_mptr;
@@ -39,13 +44,15 @@ static UInt T_JULIA_OBJ;
 
 void handle_jl_exception(void)
 {
-    jl_call2(JULIA_FUNC_showerror, JULIA_ERROR_IOBuffer,
-             jl_exception_occurred());
-    jl_value_t * string_object =
-        jl_call1(JULIA_FUNC_take_inplace, JULIA_ERROR_IOBuffer);
-    string_object = jl_array_to_string((jl_array_t *)string_object);
+    // The message is formatted on the Julia side, in a buffer that belongs
+    // to the current thread.
+    jl_value_t * exc = jl_exception_occurred();
+    jl_value_t * message = jl_call1(JULIA_FUNC_exception_message, exc);
     BEGIN_GAP_SYNC();
-    ErrorMayQuit("%s", (Int)jl_string_data(string_object), 0);
+    if (message == 0 || !jl_is_string(message))
+        ErrorMayQuit("a Julia exception of type %s occurred",
+                     (Int)jl_typeof_str(exc), 0);
+    ErrorMayQuit("%s", (Int)jl_string_data(message), 0);
     END_GAP_SYNC();
 }
 
@@ -78,6 +85,63 @@ int is_gapobj(jl_value_t * v)
     return jl_typeis(v, gap_datatype_mptr);
 }
 
+// Store the numbers of the component names of the plain record <rec> in
+// <buf>, if there is space for <len> of them, and return their number.
+// Return -1 if <rec> is not a plain record.
+//
+// This function is used by GAP.jl
+Int gap_rnams_prec(Obj rec, Int * buf, UInt len)
+{
+    if (!IS_PREC(rec))
+        return -1;
+    UInt n = LEN_PREC(rec);
+    if (n <= len) {
+        for (UInt i = 1; i <= n; i++) {
+            Int rnam = GET_RNAM_PREC(rec, i);
+            buf[i - 1] = rnam < 0 ? -rnam : rnam;
+        }
+    }
+    return n;
+}
+
+// GAP stores the names of its global variables in buckets of this size,
+// in the order in which the variables are created; the entries of a
+// bucket after the last variable are zero, and the next bucket gets
+// allocated only when it is needed. GAP does not export the number of
+// its global variables.
+#define GVAR_BUCKET_SIZE 1024
+
+static Obj NamesGVarsFunc;
+
+// Return a plain list of the names of the GAP variables whose numbers are
+// larger than <count>, in the order in which they were created. <count>
+// must not exceed the current number of GAP variables.
+//
+// The names are read from GAP's table of names, thus only the new names
+// are touched. Only if the first new variable would start a new bucket,
+// which may not be allocated yet, the number of variables is computed
+// via 'NamesGVars'.
+//
+// This function is used by GAP.jl
+Obj gap_gvar_names_since(UInt count)
+{
+    Obj res;
+    BEGIN_GAP_SYNC();
+    UInt n = count;
+    while (n % GVAR_BUCKET_SIZE != 0 && NameGVar(n + 1) != 0)
+        n++;
+    if (n % GVAR_BUCKET_SIZE == 0)
+        n = LEN_LIST(CALL_0ARGS(NamesGVarsFunc));
+    res = NEW_PLIST(n > count ? T_PLIST : T_PLIST_EMPTY, n - count);
+    for (UInt i = count + 1; i <= n; i++) {
+        // the names are immutable strings, no copies are needed
+        SET_ELM_PLIST(res, i - count, NameGVar(i));
+    }
+    SET_LEN_PLIST(res, n - count);
+    END_GAP_SYNC();
+    return res;
+}
+
 /*
  * utilities for wrapped Julia objects and functions
  */
@@ -127,6 +191,78 @@ Obj NewJuliaObj(jl_value_t * v)
 }
 
 
+/*
+ * access to properties of Julia objects via GAP's record syntax
+ */
+
+// Julia symbols for record names, indexed by the record name numbers;
+// Julia never frees symbols, so the pointers stay valid
+static jl_sym_t ** RNamSymbols;
+static UInt        RNamSymbolsLen;
+
+static Obj NameRNamFunc;
+
+// Return the Julia symbol for the record name number <rnam>, which must be
+// a positive small integer.
+static jl_sym_t * SymbolOfRNam(Obj rnam)
+{
+    UInt r = INT_INTOBJ(rnam);
+    if (r < RNamSymbolsLen && RNamSymbols[r])
+        return RNamSymbols[r];
+
+    // 'NameRNam' signals an error if <rnam> is not a valid record name
+    // number, thus the cache grows only up to the number of record names
+    Obj        name = CALL_1ARGS(NameRNamFunc, rnam);
+    jl_sym_t * sym = jl_symbol(CONST_CSTR_STRING(name));
+    if (r >= RNamSymbolsLen) {
+        UInt        len = 2 * r + 16;
+        jl_sym_t ** syms = realloc(RNamSymbols, len * sizeof(jl_sym_t *));
+        if (!syms)
+            return sym;
+        memset(syms + RNamSymbolsLen, 0,
+               (len - RNamSymbolsLen) * sizeof(jl_sym_t *));
+        RNamSymbols = syms;
+        RNamSymbolsLen = len;
+    }
+    RNamSymbols[r] = sym;
+    return sym;
+}
+
+// 'obj.rnam' for a Julia object <obj>, i.e., 'getproperty(obj, :rnam)';
+// this is installed as a method for '\.', so that more specific methods,
+// for example those for Julia modules, take precedence
+static Obj Func_JuliaGetProperty(Obj self, Obj obj, Obj rnam)
+{
+    if (!IS_JULIA_OBJ(obj))
+        ErrorMayQuit("argument is not a julia object", 0, 0);
+    if (!IS_POS_INTOBJ(rnam))
+        ErrorMayQuit("<rnam> must be a record name", 0, 0);
+
+    jl_value_t * result = jl_call2(JULIA_FUNC_getproperty, GET_JULIA_OBJ(obj),
+                                   (jl_value_t *)SymbolOfRNam(rnam));
+    if (jl_exception_occurred())
+        handle_jl_exception();
+    return gap_julia(result);
+}
+
+// 'obj.rnam := val' for a Julia object <obj>,
+// i.e., 'setproperty!(obj, :rnam, val)';
+// this is installed as a method for '\.\:\='
+static Obj Func_JuliaSetProperty(Obj self, Obj obj, Obj rnam, Obj val)
+{
+    if (!IS_JULIA_OBJ(obj))
+        ErrorMayQuit("argument is not a julia object", 0, 0);
+    if (!IS_POS_INTOBJ(rnam))
+        ErrorMayQuit("<rnam> must be a record name", 0, 0);
+
+    jl_call3(JULIA_FUNC_setproperty, GET_JULIA_OBJ(obj),
+             (jl_value_t *)SymbolOfRNam(rnam), julia_gap(val));
+    if (jl_exception_occurred())
+        handle_jl_exception();
+    return 0;
+}
+
+
 void ResetUserHasQUIT(void)
 {
     STATE(UserHasQUIT) = 0;
@@ -145,6 +281,18 @@ static Obj Func_WrapJuliaFunction(Obj self, Obj func)
     return WrapJuliaFunc(f);
 }
 
+// Call the Julia object <obj> with the entries of the list <args> as
+// arguments; this is installed as a method for 'CallFuncList'.
+static Obj Func_CallJuliaObject(Obj self, Obj obj, Obj args)
+{
+    if (!IS_JULIA_OBJ(obj))
+        ErrorMayQuit("argument is not a julia object", 0, 0);
+    if (!IS_LIST(args))
+        ErrorMayQuit("<args> must be a list", 0, 0);
+
+    return CallJuliaObject(obj, args);
+}
+
 // Export 'IS_JULIA_FUNC' to the GAP level.
 static Obj FuncIS_JULIA_FUNC(Obj self, Obj obj)
 {
@@ -253,6 +401,9 @@ static void MarkJuliaObject(Bag bag)
 // Table of functions to export
 static StructGVarFunc GVarFuncs[] = {
     GVAR_FUNC(_WrapJuliaFunction, 1, "juliafunc"),
+    GVAR_FUNC(_CallJuliaObject, 2, "obj, args"),
+    GVAR_FUNC(_JuliaGetProperty, 2, "obj, rnam"),
+    GVAR_FUNC(_JuliaSetProperty, 3, "obj, rnam, val"),
     GVAR_FUNC(IS_JULIA_FUNC, 1, "obj"),
     GVAR_FUNC(JuliaEvalString, 1, "string"),
     GVAR_FUNC(_JuliaGetGlobalVariableByModule, 2, "name, module"),
@@ -279,12 +430,16 @@ static Int InitKernel(StructInitInfo * module)
     }
 
     InitGapSync();
+    InitSerialize();
+    InitFfe();
 
     // init filters and functions
     InitHdlrFuncsFromTable(GVarFuncs);
 
     InitCopyGVar("TheTypeOfJuliaModules", &TheTypeOfJuliaModules);
     InitCopyGVar("TheTypeJuliaObject", &TheTypeJuliaObject);
+    InitFopyGVar("NamesGVars", &NamesGVarsFunc);
+    InitFopyGVar("NameRNam", &NameRNamFunc);
 
     T_JULIA_OBJ = RegisterPackageTNUM("JuliaObject", JuliaObjectTypeFunc);
 
@@ -295,17 +450,15 @@ static Int InitKernel(StructInitInfo * module)
     IsMutableObjFuncs[T_JULIA_OBJ] = &JuliaObjIsMutableFunc;
 
     // Initialize necessary variables for error handling
-    JULIA_ERROR_IOBuffer =
-        jl_call0(jl_get_function(jl_base_module, "IOBuffer"));
-    GAP_ASSERT(JULIA_ERROR_IOBuffer);
-    // store the IO buffer object to protect it from being garbage collected
-    jl_set_const(gap_module, jl_symbol("error_buffer"), JULIA_ERROR_IOBuffer);
+    JULIA_FUNC_exception_message =
+        jl_get_function(gap_module, "_julia_exception_message");
+    GAP_ASSERT(JULIA_FUNC_exception_message);
 
-    JULIA_FUNC_take_inplace = jl_get_function(jl_base_module, "take!");
-    GAP_ASSERT(JULIA_FUNC_take_inplace);
+    JULIA_FUNC_getproperty = jl_get_function(jl_base_module, "getproperty");
+    GAP_ASSERT(JULIA_FUNC_getproperty);
 
-    JULIA_FUNC_showerror = jl_get_function(jl_base_module, "showerror");
-    GAP_ASSERT(JULIA_FUNC_showerror);
+    JULIA_FUNC_setproperty = jl_get_function(jl_base_module, "setproperty!");
+    GAP_ASSERT(JULIA_FUNC_setproperty);
 
     // paranoia: verify that Julia's GMP has the BITS_PER_LIMB we expect
     jl_module_t * gmp_module =
@@ -51,4 +51,10 @@ int is_gapffe(jl_value_t * v);
 //
 int is_gapobj(jl_value_t * v);
 
+//
+Int gap_rnams_prec(Obj rec, Int * buf, UInt len);
+
+//
+Obj gap_gvar_names_since(UInt count);
+
 #endif
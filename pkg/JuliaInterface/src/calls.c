@@ -102,7 +102,10 @@ inline jl_value_t * GET_JULIA_FUNC(Obj func)
         ((const JuliaFuncBag *)CONST_ADDR_OBJ(func))->juliaFunc);
 }
 
-static ALWAYS_INLINE Obj DoCallJuliaFunc(Obj func, const int narg, Obj * a)
+// Call the Julia object <f> with the <narg> GAP objects in <a> as
+// arguments; the entries of <a> get overwritten with their Julia
+// counterparts.
+static ALWAYS_INLINE Obj CallJuliaValue(jl_value_t * f, const int narg, Obj * a)
 {
     jl_value_t * result;
 
@@ -110,7 +113,6 @@ static ALWAYS_INLINE Obj DoCallJuliaFunc(Obj func, const int narg, Obj * a)
         a[i] = (Obj)julia_gap(a[i]);
     }
 
-    jl_value_t * f = (jl_value_t *)GET_JULIA_FUNC(func);
     switch (narg) {
     case 0:
         result = jl_call0(f);
@@ -134,6 +136,11 @@ static ALWAYS_INLINE Obj DoCallJuliaFunc(Obj func, const int narg, Obj * a)
     return gap_julia(result);
 }
 
+static ALWAYS_INLINE Obj DoCallJuliaFunc(Obj func, const int narg, Obj * a)
+{
+    return CallJuliaValue(GET_JULIA_FUNC(func), narg, a);
+}
+
 //
 //
 //
@@ -194,6 +201,21 @@ static Obj DoCallJuliaFuncXArg(Obj func, Obj args)
 }
 
 
+//
+//
+//
+Obj CallJuliaObject(Obj obj, Obj args)
+{
+    const int len = LEN_LIST(args);
+    Obj       a[len];
+    // holes in <args> become 'nothing'
+    for (int i = 0; i < len; i++) {
+        a[i] = ELM0_LIST(args, i + 1);
+    }
+    return CallJuliaValue(GET_JULIA_OBJ(obj), len, a);
+}
+
+
 //
 //
 //
@@ -23,4 +23,8 @@ extern jl_value_t * GET_JULIA_FUNC(Obj obj);
 // Creates a new julia function GAP object from the julia function pointer f.
 extern Obj WrapJuliaFunc(jl_value_t * f);
 
+// Calls the Julia object wrapped in the GAP object <obj> with the entries
+// of the GAP list <args> as arguments.
+extern Obj CallJuliaObject(Obj obj, Obj args);
+
 #endif
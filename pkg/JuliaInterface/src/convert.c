@@ -15,6 +15,8 @@
 #include "sync.h"
 #include "JuliaInterface.h"
 
+#include <string.h>
+
 // Turn a GAP object into a Julia object.
 // This function is used by GAP.jl and also by `DoCallJuliaFunc`.
 jl_value_t * julia_gap(Obj obj)
@@ -63,3 +65,126 @@ Obj gap_julia(jl_value_t * julia_obj)
     }
     return NewJuliaObj(julia_obj);
 }
+
+// Return the entry at position <pos> in the GAP list <list>,
+// or its numerator (<part> = 1) or denominator (<part> = 2),
+// or 0 if there is no such integer.
+// For <part> = 0, the entry must be an integer.
+static Obj IntListEntry(Obj list, UInt pos, Int part)
+{
+    Obj x = IS_PLIST(list) && pos <= LEN_PLIST(list) ? ELM_PLIST(list, pos)
+                                                     : ELM0_LIST(list, pos);
+    if (x == 0)
+        return 0;
+    if (IS_INT(x))
+        return part == 2 ? INTOBJ_INT(1) : x;
+    if (part != 0 && TNUM_OBJ(x) == T_RAT)
+        return CONST_ADDR_OBJ(x)[part - 1];
+    return 0;
+}
+
+// Store in <sizes> the signed numbers of limbs of the entries in the GAP
+// list <list> of length <len>, resp. of their numerators or denominators,
+// see 'IntListEntry'. Nonzero small integers count as one limb.
+// Return 0, or the first position where the list has no suitable entry.
+//
+// This function is used by GAP.jl
+Int gap_int_list_sizes(Obj list, UInt len, Int part, Int * sizes)
+{
+    Int result = 0;
+    BEGIN_GAP_SYNC();
+    for (UInt i = 0; i < len; i++) {
+        Obj x = IntListEntry(list, i + 1, part);
+        if (x == 0) {
+            result = i + 1;
+            break;
+        }
+        if (IS_INTOBJ(x)) {
+            Int v = INT_INTOBJ(x);
+            sizes[i] = v > 0 ? 1 : v < 0 ? -1 : 0;
+        }
+        else if (TNUM_OBJ(x) == T_INTNEG)
+            sizes[i] = -(Int)SIZE_INT(x);
+        else
+            sizes[i] = SIZE_INT(x);
+    }
+    END_GAP_SYNC();
+    return result;
+}
+
+// Copy the limbs of the absolute values of the entries in the GAP list
+// <list> of length <len>, resp. of their numerators or denominators,
+// to the buffers <limbs>, which must be large enough,
+// see 'gap_int_list_sizes'.
+//
+// This function is used by GAP.jl
+void gap_int_list_limbs(Obj list, UInt len, Int part, UInt ** limbs)
+{
+    BEGIN_GAP_SYNC();
+    for (UInt i = 0; i < len; i++) {
+        Obj x = IntListEntry(list, i + 1, part);
+        if (x == 0)
+            break;
+        if (IS_INTOBJ(x)) {
+            Int v = INT_INTOBJ(x);
+            if (v != 0)
+                limbs[i][0] = v < 0 ? -(UInt)v : (UInt)v;
+        }
+        else {
+            memcpy(limbs[i], CONST_ADDR_INT(x), SIZE_INT(x) * sizeof(UInt));
+        }
+    }
+    END_GAP_SYNC();
+}
+
+static Obj ObjIntLimbs(const UInt * limbs, Int size)
+{
+    return size == 0 ? INTOBJ_INT(0) : MakeObjInt(limbs, size);
+}
+
+// Return a GAP plain list of length <len> whose entries are given by
+// the limbs and signed sizes of their numerators and denominators.
+// The fractions must be reduced and have positive denominators.
+// If <dens> is NULL then the entries are the integers given by <nums>.
+//
+// This function is used by GAP.jl
+Obj gap_rat_list_from_limbs(UInt        len,
+                            UInt **     nums,
+                            const Int * num_sizes,
+                            UInt **     dens,
+                            const Int * den_sizes)
+{
+    Obj list;
+    BEGIN_GAP_SYNC();
+    list = NEW_PLIST(len ? T_PLIST_CYC : T_PLIST_EMPTY, len);
+    for (UInt i = 0; i < len; i++) {
+        Obj x = ObjIntLimbs(nums[i], num_sizes[i]);
+        if (dens != 0 && !(den_sizes[i] == 1 && dens[i][0] == 1)) {
+            Obj den = ObjIntLimbs(dens[i], den_sizes[i]);
+            Obj num = x;
+            x = NewBag(T_RAT, 2 * sizeof(Obj));
+            ADDR_OBJ(x)[0] = num;
+            ADDR_OBJ(x)[1] = den;
+            CHANGED_BAG(x);
+        }
+        SET_ELM_PLIST(list, i + 1, x);
+        SET_LEN_PLIST(list, i + 1);
+        CHANGED_BAG(list);
+    }
+    END_GAP_SYNC();
+    return list;
+}
+
+// Mark the plain list <list> as strictly sorted, without comparing its
+// entries; this is used for sets whose elements were sorted on the
+// Julia side. Empty lists are already known to be strictly sorted, and
+// lists that are not plain or not dense are left alone.
+//
+// This function is used by GAP.jl
+void gap_set_ssorted_plist(Obj list)
+{
+    BEGIN_GAP_SYNC();
+    if (IS_PLIST(list) && LEN_PLIST(list) > 0 && IS_DENSE_LIST(list))
+        SET_FILT_LIST(list, FN_IS_SSORT);
+    END_GAP_SYNC();
+}
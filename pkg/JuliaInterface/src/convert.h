@@ -19,4 +19,17 @@
 extern jl_value_t * julia_gap(Obj obj);
 extern Obj          gap_julia(jl_value_t * julia_obj);
 
+// Batched conversion of GAP integers and rationals to and from limbs.
+extern Int  gap_int_list_sizes(Obj list, UInt len, Int part, Int * sizes);
+extern void gap_int_list_limbs(Obj list, UInt len, Int part, UInt ** limbs);
+extern Obj  gap_rat_list_from_limbs(UInt        len,
+                                    UInt **     nums,
+                                    const Int * num_sizes,
+                                    UInt **     dens,
+                                    const Int * den_sizes);
+
+// Mark the dense plain list <list> as strictly sorted. The entries of <list>
+// must be strictly sorted and lie in the same family.
+extern void gap_set_ssorted_plist(Obj list);
+
 #endif
@@ -0,0 +1,265 @@
+//
+//  This file is part of GAP.jl, a bidirectional interface between Julia and
+//  the GAP computer algebra system.
+//
+//  Copyright of GAP.jl and its parts belongs to its developers.
+//  Please refer to its README.md file for details.
+//
+//  SPDX-License-Identifier: LGPL-3.0-or-later
+//
+// Conversion of vectors and matrices over small finite fields.
+//
+// The Julia side describes the entries by their values as GAP FFEs,
+// thus no intermediate Julia or GAP objects are needed for the entries.
+// Compressed rows are created and read directly via their bit resp. byte
+// data.
+
+#include "ffe.h"
+#include "sync.h"
+
+static Obj TYPE_LIST_GF2VEC;
+static Obj TYPE_LIST_GF2VEC_LOCKED;
+static Obj TYPE_LIST_GF2MAT;
+static Obj TYPE_VEC8BIT;
+static Obj TYPE_VEC8BIT_LOCKED;
+static Obj TYPE_MAT8BIT;
+static Obj IsGF2VectorRep;
+static Obj Is8BitVectorRep;
+static Obj IsGF2MatrixRep;
+static Obj Is8BitMatrixRep;
+
+static FF FieldOrError(UInt p, UInt d)
+{
+    FF fld = FiniteField(p, d);
+    if (fld == 0)
+        ErrorMayQuit("GF(%d^%d) is not supported", (Int)p, (Int)d);
+    return fld;
+}
+
+static void CheckValue(UInt2 val, UInt q)
+{
+    if (val >= q)
+        ErrorMayQuit("invalid value %d for an element of a field of size %d",
+                     (Int)val, (Int)q);
+}
+
+// Create a plain list with the FFEs in <fld> described by <vals>.
+static Obj PlainRow(const UInt2 * vals, UInt len, FF fld)
+{
+    UInt q = SIZE_FF(fld);
+    Obj  row = NEW_PLIST(len ? T_PLIST_FFE : T_PLIST_EMPTY, len);
+    for (UInt j = 0; j < len; j++) {
+        CheckValue(vals[j], q);
+        SET_ELM_PLIST(row, j + 1, NEW_FFE(fld, vals[j]));
+    }
+    SET_LEN_PLIST(row, len);
+    return row;
+}
+
+// Create a GF(2) vector of type <type> described by <vals>.
+static Obj GF2Row(const UInt2 * vals, UInt len, Obj type)
+{
+    Obj row = NewBag(T_DATOBJ, SIZE_PLEN_GF2VEC(len));
+    SetTypeDatObj(row, type);
+    SET_LEN_GF2VEC(row, len);
+    UInt * blocks = BLOCKS_GF2VEC(row);
+    for (UInt j = 0; j < len; j++) {
+        CheckValue(vals[j], 2);
+        if (vals[j])
+            blocks[j / BIPEB] |= (UInt)1 << (j % BIPEB);
+    }
+    return row;
+}
+
+// Create an 8-bit vector over the field with <q> elements of type <type>
+// described by <vals>.
+static Obj Vec8BitRow(const UInt2 * vals, UInt len, UInt q, Obj type)
+{
+    Obj  info = GetFieldInfo8Bit(q);
+    UInt elts = ELS_BYTE_FIELDINFO_8BIT(info);
+    Obj  row = NewBag(T_DATOBJ, SIZE_VEC8BIT(len, elts));
+    SetTypeDatObj(row, type);
+    SET_LEN_VEC8BIT(row, len);
+    SET_FIELD_VEC8BIT(row, q);
+
+    // each byte stores <elts> entries as the digits of a number in base <q>
+    const UInt1 * felts = FELT_FFE_FIELDINFO_8BIT(info);
+    UInt1 *       bytes = BYTES_VEC8BIT(row);
+    UInt          k = 0, pow = 1;
+    for (UInt j = 0; j < len; j++) {
+        CheckValue(vals[j], q);
+        bytes[j / elts] += felts[vals[j]] * pow;
+        if (++k == elts) {
+            k = 0;
+            pow = 1;
+        }
+        else {
+            pow *= q;
+        }
+    }
+    return row;
+}
+
+Obj gap_ffe_vector(const UInt2 * vals, UInt len, UInt p, UInt d)
+{
+    Obj vec;
+    BEGIN_GAP_SYNC();
+    FF   fld = FieldOrError(p, d);
+    UInt q = SIZE_FF(fld);
+    if (len == 0 || q > 256)
+        vec = PlainRow(vals, len, fld);
+    else if (q == 2)
+        vec = GF2Row(vals, len, TYPE_LIST_GF2VEC);
+    else
+        vec = Vec8BitRow(vals, len, q,
+                         CALL_2ARGS(TYPE_VEC8BIT, INTOBJ_INT(q), True));
+    END_GAP_SYNC();
+    return vec;
+}
+
+Obj gap_ffe_matrix(const UInt2 * vals, UInt nrows, UInt ncols, UInt p, UInt d)
+{
+    Obj mat;
+    BEGIN_GAP_SYNC();
+    FF   fld = FieldOrError(p, d);
+    UInt q = SIZE_FF(fld);
+    if (nrows == 0 || ncols == 0 || q > 256) {
+        mat = NEW_PLIST(nrows ? T_PLIST_TAB : T_PLIST_EMPTY, nrows);
+        for (UInt i = 0; i < nrows; i++) {
+            Obj row = PlainRow(vals + i * ncols, ncols, fld);
+            SET_ELM_PLIST(mat, i + 1, row);
+            SET_LEN_PLIST(mat, i + 1);
+            CHANGED_BAG(mat);
+        }
+    }
+    else {
+        // a compressed matrix is a positional object with its number of
+        // rows and the rows, whose types are locked
+        Obj rowtype = (q == 2) ? TYPE_LIST_GF2VEC_LOCKED
+                               : CALL_2ARGS(TYPE_VEC8BIT_LOCKED,
+                                            INTOBJ_INT(q), True);
+        mat = NewBag(T_POSOBJ, (nrows + 2) * sizeof(Obj));
+        ADDR_OBJ(mat)[1] = INTOBJ_INT(nrows);
+        for (UInt i = 0; i < nrows; i++) {
+            const UInt2 * rowvals = vals + i * ncols;
+            Obj           row = (q == 2)
+                                    ? GF2Row(rowvals, ncols, rowtype)
+                                    : Vec8BitRow(rowvals, ncols, q, rowtype);
+            ADDR_OBJ(mat)[i + 2] = row;
+            CHANGED_BAG(mat);
+        }
+        SET_TYPE_POSOBJ(mat, (q == 2) ? TYPE_LIST_GF2MAT
+                                      : CALL_2ARGS(TYPE_MAT8BIT,
+                                                   INTOBJ_INT(q), True));
+        CHANGED_BAG(mat);
+    }
+    END_GAP_SYNC();
+    return mat;
+}
+
+// Return the value of the FFE <x> as an element of <fld>, which has <q>
+// elements.
+static UInt2 ValueInField(Obj x, FF fld, UInt q)
+{
+    if (x == 0 || !IS_FFE(x))
+        ErrorMayQuit("the entries must be finite field elements", 0, 0);
+    FF f = FLD_FFE(x);
+    if (f == fld)
+        return VAL_FFE(x);
+    if (CHAR_FF(f) != CHAR_FF(fld) || DEGR_FF(fld) % DEGR_FF(f) != 0)
+        ErrorMayQuit("the entries must lie in GF(%d^%d)", (Int)CHAR_FF(fld),
+                     (Int)DEGR_FF(fld));
+    // Z(q')^k = Z(q)^(k * (q-1)/(q'-1)) for the subfield with q' elements
+    UInt v = VAL_FFE(x);
+    if (v == 0)
+        return 0;
+    return (v - 1) * ((q - 1) / (SIZE_FF(f) - 1)) + 1;
+}
+
+static void CheckLength(UInt actual, UInt len)
+{
+    if (actual != len)
+        ErrorMayQuit("the vector has length %d, not %d", (Int)actual,
+                     (Int)len);
+}
+
+static void RowValues(Obj row, UInt2 * vals, UInt len, FF fld)
+{
+    UInt q = SIZE_FF(fld);
+
+    if (IS_PLIST(row)) {
+        CheckLength(LEN_PLIST(row), len);
+        for (UInt j = 0; j < len; j++)
+            vals[j] = ValueInField(ELM_PLIST(row, j + 1), fld, q);
+    }
+    else if (DoFilter(IsGF2VectorRep, row) == True) {
+        CheckLength(LEN_GF2VEC(row), len);
+        for (UInt j = 0; j < len; j++)
+            vals[j] = ValueInField(ELM_GF2VEC(row, j + 1), fld, q);
+    }
+    else if (DoFilter(Is8BitVectorRep, row) == True) {
+        CheckLength(LEN_VEC8BIT(row), len);
+        Obj           info = GetFieldInfo8Bit(FIELD_VEC8BIT(row));
+        UInt          elts = ELS_BYTE_FIELDINFO_8BIT(info);
+        const UInt1 * gettab = GETELT_FIELDINFO_8BIT(info);
+        const Obj *   convtab = FFE_FELT_FIELDINFO_8BIT(info);
+        const UInt1 * bytes = BYTES_VEC8BIT(row);
+        for (UInt j = 0; j < len; j++) {
+            UInt1 felt = gettab[256 * (j % elts) + bytes[j / elts]];
+            vals[j] = ValueInField(convtab[felt], fld, q);
+        }
+    }
+    else {
+        CheckLength(LEN_LIST(row), len);
+        for (UInt j = 0; j < len; j++)
+            vals[j] = ValueInField(ELM0_LIST(row, j + 1), fld, q);
+    }
+}
+
+void gap_ffe_vector_values(Obj vec, UInt2 * vals, UInt len, UInt p, UInt d)
+{
+    BEGIN_GAP_SYNC();
+    RowValues(vec, vals, len, FieldOrError(p, d));
+    END_GAP_SYNC();
+}
+
+void gap_ffe_matrix_values(
+    Obj mat, UInt2 * vals, UInt nrows, UInt ncols, UInt p, UInt d)
+{
+    BEGIN_GAP_SYNC();
+    FF fld = FieldOrError(p, d);
+
+    if (IS_PLIST(mat) || DoFilter(IsGF2MatrixRep, mat) == True ||
+        DoFilter(Is8BitMatrixRep, mat) == True) {
+        CheckLength(LEN_LIST(mat), nrows);
+        for (UInt i = 0; i < nrows; i++) {
+            Obj row = ELM_LIST(mat, i + 1);
+            RowValues(row, vals + i * ncols, ncols, fld);
+        }
+    }
+    else {
+        // other matrix objects, for example in 'IsPlistMatrixRep'
+        UInt q = SIZE_FF(fld);
+        for (UInt i = 0; i < nrows; i++) {
+            for (UInt j = 0; j < ncols; j++) {
+                Obj x = ELM_MAT(mat, INTOBJ_INT(i + 1), INTOBJ_INT(j + 1));
+                vals[i * ncols + j] = ValueInField(x, fld, q);
+            }
+        }
+    }
+    END_GAP_SYNC();
+}
+
+void InitFfe(void)
+{
+    InitFopyGVar("TYPE_VEC8BIT", &TYPE_VEC8BIT);
+    InitFopyGVar("TYPE_VEC8BIT_LOCKED", &TYPE_VEC8BIT_LOCKED);
+    InitFopyGVar("TYPE_MAT8BIT", &TYPE_MAT8BIT);
+    InitCopyGVar("TYPE_LIST_GF2VEC", &TYPE_LIST_GF2VEC);
+    InitCopyGVar("TYPE_LIST_GF2VEC_LOCKED", &TYPE_LIST_GF2VEC_LOCKED);
+    InitCopyGVar("TYPE_LIST_GF2MAT", &TYPE_LIST_GF2MAT);
+    InitCopyGVar("IsGF2VectorRep", &IsGF2VectorRep);
+    InitCopyGVar("Is8BitVectorRep", &Is8BitVectorRep);
+    InitCopyGVar("IsGF2MatrixRep", &IsGF2MatrixRep);
+    InitCopyGVar("Is8BitMatrixRep", &Is8BitMatrixRep);
+}
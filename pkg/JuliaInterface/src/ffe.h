@@ -0,0 +1,51 @@
+//
+//  This file is part of GAP.jl, a bidirectional interface between Julia and
+//  the GAP computer algebra system.
+//
+//  Copyright of GAP.jl and its parts belongs to its developers.
+//  Please refer to its README.md file for details.
+//
+//  SPDX-License-Identifier: LGPL-3.0-or-later
+//
+// Conversion of vectors and matrices over small finite fields.
+
+#ifndef JULIAINTERFACE_FFE_H
+#define JULIAINTERFACE_FFE_H
+
+#include <gap_all.h>    // GAP headers
+
+// The entries are given resp. returned by their values as GAP FFEs in
+// GF(<p>^<d>), that is, 0 for zero and k+1 for Z(<p>^<d>)^k.
+// The entries of the matrices are stored row by row.
+
+// Return the GAP vector of length <len> with entries described by <vals>.
+// The vector is compressed if the field has at most 256 elements.
+//
+// This function is used by GAP.jl
+Obj gap_ffe_vector(const UInt2 * vals, UInt len, UInt p, UInt d);
+
+// Return the GAP matrix with <nrows> rows and <ncols> columns with entries
+// described by <vals>. The matrix is compressed if the field has at most
+// 256 elements.
+//
+// This function is used by GAP.jl
+Obj gap_ffe_matrix(const UInt2 * vals, UInt nrows, UInt ncols, UInt p, UInt d);
+
+// Store the values of the entries of the GAP vector <vec> of length <len>
+// in <vals>. Signal an error if an entry does not lie in GF(<p>^<d>).
+//
+// This function is used by GAP.jl
+void gap_ffe_vector_values(Obj vec, UInt2 * vals, UInt len, UInt p, UInt d);
+
+// Store the values of the entries of the GAP matrix <mat> with <nrows> rows
+// and <ncols> columns in <vals>. Signal an error if an entry does not lie
+// in GF(<p>^<d>).
+//
+// This function is used by GAP.jl
+void gap_ffe_matrix_values(
+    Obj mat, UInt2 * vals, UInt nrows, UInt ncols, UInt p, UInt d);
+
+// Initialize the copies of GAP variables needed for these conversions.
+void InitFfe(void);
+
+#endif
@@ -0,0 +1,127 @@
+//
+//  This file is part of GAP.jl, a bidirectional interface between Julia and
+//  the GAP computer algebra system.
+//
+//  Copyright of GAP.jl and its parts belongs to its developers.
+//  Please refer to its README.md file for details.
+//
+//  SPDX-License-Identifier: LGPL-3.0-or-later
+//
+// Interrupt running GAP computations from a helper thread, in order to
+// implement time limits and cancellation on the Julia side.
+//
+// A Julia timer cannot be used for this purpose: while the GAP kernel is
+// busy, the Julia scheduler does not get a chance to run its callbacks.
+// Instead we start a separate OS thread which does what GAP's own SIGINT
+// handler does, namely call 'InterruptExecStat'. The GAP executor then
+// raises a "user interrupt" error at the next statement, which reaches
+// Julia through the usual error handling.
+
+#include "interrupt.h"
+
+#include <gap_all.h>    // GAP headers
+
+#include <errno.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+
+enum {
+    WATCHDOG_RUNNING,
+    WATCHDOG_STOP,
+    WATCHDOG_FIRE,
+};
+
+typedef struct {
+    pthread_t       thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t  cond;
+    struct timespec deadline;
+    int             has_deadline;
+    int             request;
+    int             fired;
+} Watchdog;
+
+static void * WatchdogThread(void * arg)
+{
+    Watchdog * wd = (Watchdog *)arg;
+
+    pthread_mutex_lock(&wd->mutex);
+    while (wd->request == WATCHDOG_RUNNING) {
+        if (!wd->has_deadline) {
+            pthread_cond_wait(&wd->cond, &wd->mutex);
+        }
+        else if (pthread_cond_timedwait(&wd->cond, &wd->mutex,
+                                        &wd->deadline) == ETIMEDOUT) {
+            wd->request = WATCHDOG_FIRE;
+        }
+    }
+    if (wd->request == WATCHDOG_FIRE) {
+        // the same as GAP's SIGINT handler does
+        InterruptExecStat();
+        wd->fired = 1;
+    }
+    pthread_mutex_unlock(&wd->mutex);
+    return 0;
+}
+
+void * gap_start_watchdog(double seconds)
+{
+    Watchdog * wd = (Watchdog *)calloc(1, sizeof(Watchdog));
+    if (!wd)
+        return 0;
+
+    wd->request = WATCHDOG_RUNNING;
+    if (seconds > 0 && isfinite(seconds)) {
+        clock_gettime(CLOCK_REALTIME, &wd->deadline);
+        double secs = floor(seconds);
+        wd->deadline.tv_sec += (time_t)secs;
+        wd->deadline.tv_nsec += (long)((seconds - secs) * 1e9);
+        if (wd->deadline.tv_nsec >= 1000000000L) {
+            wd->deadline.tv_sec += 1;
+            wd->deadline.tv_nsec -= 1000000000L;
+        }
+        wd->has_deadline = 1;
+    }
+
+    pthread_mutex_init(&wd->mutex, 0);
+    pthread_cond_init(&wd->cond, 0);
+    if (pthread_create(&wd->thread, 0, WatchdogThread, wd) != 0) {
+        pthread_cond_destroy(&wd->cond);
+        pthread_mutex_destroy(&wd->mutex);
+        free(wd);
+        return 0;
+    }
+    return wd;
+}
+
+void gap_trigger_watchdog(void * arg)
+{
+    Watchdog * wd = (Watchdog *)arg;
+    pthread_mutex_lock(&wd->mutex);
+    if (wd->request == WATCHDOG_RUNNING) {
+        wd->request = WATCHDOG_FIRE;
+        pthread_cond_signal(&wd->cond);
+    }
+    pthread_mutex_unlock(&wd->mutex);
+}
+
+int gap_stop_watchdog(void * arg)
+{
+    Watchdog * wd = (Watchdog *)arg;
+    pthread_mutex_lock(&wd->mutex);
+    if (wd->request == WATCHDOG_RUNNING) {
+        wd->request = WATCHDOG_STOP;
+        pthread_cond_signal(&wd->cond);
+    }
+    pthread_mutex_unlock(&wd->mutex);
+
+    pthread_join(wd->thread, 0);
+
+    int fired = wd->fired;
+    pthread_cond_destroy(&wd->cond);
+    pthread_mutex_destroy(&wd->mutex);
+    free(wd);
+    return fired;
+}
@@ -0,0 +1,39 @@
+//
+//  This file is part of GAP.jl, a bidirectional interface between Julia and
+//  the GAP computer algebra system.
+//
+//  Copyright of GAP.jl and its parts belongs to its developers.
+//  Please refer to its README.md file for details.
+//
+//  SPDX-License-Identifier: LGPL-3.0-or-later
+//
+// Interrupt running GAP computations from a helper thread, in order to
+// implement time limits and cancellation on the Julia side.
+
+#ifndef JULIAINTERFACE_INTERRUPT_H
+#define JULIAINTERFACE_INTERRUPT_H
+
+// Start a watchdog thread which interrupts the GAP kernel (as if the user
+// had pressed Ctrl-C) after <seconds> seconds, or when it is triggered via
+// 'gap_trigger_watchdog'. If <seconds> is not positive or not finite, then
+// the watchdog waits for a trigger only.
+// Returns NULL if the thread could not be started.
+//
+// This function is used by GAP.jl
+void * gap_start_watchdog(double seconds);
+
+// Ask the watchdog <wd> to interrupt the GAP kernel right now, unless it
+// has already done so or has been stopped.
+// This function may be called from any thread.
+//
+// This function is used by GAP.jl
+void gap_trigger_watchdog(void * wd);
+
+// Stop the watchdog <wd>, wait for its thread to terminate, and release
+// its resources. Returns 1 if the watchdog has interrupted the GAP kernel,
+// and 0 otherwise.
+//
+// This function is used by GAP.jl
+int gap_stop_watchdog(void * wd);
+
+#endif
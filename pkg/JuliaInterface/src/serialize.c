@@ -0,0 +1,1089 @@
+//
+//  This file is part of GAP.jl, a bidirectional interface between Julia and
+//  the GAP computer algebra system.
+//
+//  Copyright of GAP.jl and its parts belongs to its developers.
+//  Please refer to its README.md file for details.
+//
+//  SPDX-License-Identifier: LGPL-3.0-or-later
+//
+// Binary serialization of GAP objects.
+//
+// The format starts with a header (magic bytes, format version, and the
+// number of bytes per limb), followed by the root object. Each object is
+// encoded as a one byte tag followed by its data; the data of containers
+// consists of the encodings of their entries. Lengths and indices are
+// stored as LEB128 varints, everything else in native byte order.
+//
+// Every non-immediate object gets an index in the order in which it is
+// written. When an object is encountered again, only a back reference to
+// its index is written. Containers are created before their entries are
+// read, so that also cyclic structures can be restored.
+//
+// The reader does not trust its input: every decoded value is checked
+// against the invariants of the kernel object it becomes, before the
+// object is handed out, and invalid data results in an error.
+
+#include "serialize.h"
+#include "sync.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define SERIALIZE_VERSION 1
+
+static const char SerializeMagic[4] = { 'G', 'J', 'L', 'S' };
+
+enum {
+    TAG_INTOBJ = 1,
+    TAG_INTPOS,
+    TAG_INTNEG,
+    TAG_RAT,
+    TAG_CYC,
+    TAG_FFE,
+    TAG_MACFLOAT,
+    TAG_PERM2,
+    TAG_PERM4,
+    TAG_TRANS2,
+    TAG_TRANS4,
+    TAG_PPERM2,
+    TAG_PPERM4,
+    TAG_TRUE,
+    TAG_FALSE,
+    TAG_FAIL,
+    TAG_CHAR,
+    TAG_PLIST,
+    TAG_STRING,
+    TAG_BLIST,
+    TAG_RANGE,
+    TAG_PREC,
+    TAG_GF2VEC,
+    TAG_VEC8BIT,
+    TAG_GF2MAT,
+    TAG_MAT8BIT,
+    TAG_BACKREF,
+    TAG_HOLE,
+};
+
+// flags stored for lists and records
+enum {
+    FLAG_IMMUTABLE = 1,
+    FLAG_SSORT = 2,
+};
+
+static Obj COEFFS_CYC;
+static Obj CycList;
+static Obj Q_VEC8BIT;
+static Obj TYPE_VEC8BIT;
+static Obj TYPE_VEC8BIT_LOCKED;
+static Obj TYPE_MAT8BIT;
+static Obj TYPE_LIST_GF2VEC;
+static Obj TYPE_LIST_GF2VEC_IMM;
+static Obj TYPE_LIST_GF2VEC_LOCKED;
+static Obj TYPE_LIST_GF2VEC_IMM_LOCKED;
+static Obj TYPE_LIST_GF2MAT;
+static Obj TYPE_LIST_GF2MAT_IMM;
+static Obj IsGF2VectorRep;
+static Obj Is8BitVectorRep;
+static Obj IsGF2MatrixRep;
+static Obj Is8BitMatrixRep;
+
+
+/****************************************************************************
+**
+**  Writing
+*/
+
+typedef struct {
+    Obj  buf;      // GAP string into which we write
+    UInt len;      // number of bytes written so far
+    Obj  seen;     // object map: object -> its index
+    UInt count;    // number of indexed objects
+} Writer;
+
+static void WriteBytes(Writer * w, const void * data, UInt n)
+{
+    GrowString(w->buf, w->len + n);
+    memcpy(CHARS_STRING(w->buf) + w->len, data, n);
+    w->len += n;
+}
+
+static void WriteByte(Writer * w, UInt1 b)
+{
+    WriteBytes(w, &b, 1);
+}
+
+static void WriteUInt(Writer * w, UInt n)
+{
+    UInt1 buf[10];
+    int   i = 0;
+    do {
+        buf[i] = n & 0x7f;
+        n >>= 7;
+        if (n)
+            buf[i] |= 0x80;
+        i++;
+    } while (n);
+    WriteBytes(w, buf, i);
+}
+
+static void WriteInt(Writer * w, Int n)
+{
+    WriteBytes(w, &n, sizeof(Int));
+}
+
+// Write <tag> for the non-immediate object <obj>, and assign the next index
+// to <obj>.
+static void WriteTagAndIndex(Writer * w, UInt1 tag, Obj obj)
+{
+    w->count++;
+    AddObjMap(w->seen, obj, INTOBJ_INT(w->count));
+    WriteByte(w, tag);
+}
+
+static void WriteObj(Writer * w, Obj obj);
+
+static BOOL HasFilter(Obj filter, Obj obj)
+{
+    return filter && DoFilter(filter, obj) == True;
+}
+
+static void WriteGF2Vec(Writer * w, Obj obj)
+{
+    // the data after the type consists of the length and the bits
+    WriteTagAndIndex(w, TAG_GF2VEC, obj);
+    WriteByte(w, IS_MUTABLE_OBJ(obj) ? 0 : FLAG_IMMUTABLE);
+    WriteUInt(w, SIZE_OBJ(obj) - sizeof(Obj));
+    WriteBytes(w, CONST_ADDR_OBJ(obj) + 1, SIZE_OBJ(obj) - sizeof(Obj));
+}
+
+static void WriteVec8Bit(Writer * w, Obj obj)
+{
+    WriteTagAndIndex(w, TAG_VEC8BIT, obj);
+    WriteByte(w, IS_MUTABLE_OBJ(obj) ? 0 : FLAG_IMMUTABLE);
+    WriteUInt(w, INT_INTOBJ(CALL_1ARGS(Q_VEC8BIT, obj)));
+    WriteUInt(w, SIZE_OBJ(obj) - sizeof(Obj));
+    WriteBytes(w, CONST_ADDR_OBJ(obj) + 1, SIZE_OBJ(obj) - sizeof(Obj));
+}
+
+// compressed matrices are positional objects whose first entry is the
+// number of rows, followed by the rows
+static void WriteCompressedMat(Writer * w, UInt1 tag, Obj obj)
+{
+    UInt len = INT_INTOBJ(CONST_ADDR_OBJ(obj)[1]);
+    WriteTagAndIndex(w, tag, obj);
+    WriteByte(w, IS_MUTABLE_OBJ(obj) ? 0 : FLAG_IMMUTABLE);
+    if (tag == TAG_MAT8BIT)
+        WriteUInt(w, INT_INTOBJ(CALL_1ARGS(Q_VEC8BIT, CONST_ADDR_OBJ(obj)[2])));
+    WriteUInt(w, len);
+    for (UInt i = 1; i <= len; i++)
+        WriteObj(w, CONST_ADDR_OBJ(obj)[i + 1]);
+}
+
+static void WriteObj(Writer * w, Obj obj)
+{
+    if (obj == 0) {
+        WriteByte(w, TAG_HOLE);
+        return;
+    }
+    if (IS_INTOBJ(obj)) {
+        WriteByte(w, TAG_INTOBJ);
+        WriteInt(w, INT_INTOBJ(obj));
+        return;
+    }
+    if (IS_FFE(obj)) {
+        Obj fld = FLD_FFE(obj);
+        WriteByte(w, TAG_FFE);
+        WriteUInt(w, CHAR_FF(fld));
+        WriteUInt(w, DEGR_FF(fld));
+        WriteUInt(w, VAL_FFE(obj));
+        return;
+    }
+    if (obj == True || obj == False || obj == Fail) {
+        WriteByte(w, obj == True ? TAG_TRUE : obj == False ? TAG_FALSE : TAG_FAIL);
+        return;
+    }
+
+    Obj ref = LookupObjMap(w->seen, obj);
+    if (ref) {
+        WriteByte(w, TAG_BACKREF);
+        WriteUInt(w, INT_INTOBJ(ref));
+        return;
+    }
+
+    UInt tnum = TNUM_OBJ(obj);
+    switch (tnum) {
+    case T_INTPOS:
+    case T_INTNEG:
+        WriteTagAndIndex(w, tnum == T_INTPOS ? TAG_INTPOS : TAG_INTNEG, obj);
+        WriteUInt(w, SIZE_INT(obj));
+        WriteBytes(w, CONST_ADDR_INT(obj), SIZE_INT(obj) * sizeof(UInt));
+        return;
+
+    case T_RAT:
+        WriteTagAndIndex(w, TAG_RAT, obj);
+        WriteObj(w, CONST_ADDR_OBJ(obj)[0]);
+        WriteObj(w, CONST_ADDR_OBJ(obj)[1]);
+        return;
+
+    case T_CYC: {
+        Obj coeffs = CALL_1ARGS(COEFFS_CYC, obj);
+        UInt n = LEN_PLIST(coeffs);
+        WriteTagAndIndex(w, TAG_CYC, obj);
+        WriteUInt(w, n);
+        for (UInt i = 1; i <= n; i++)
+            WriteObj(w, ELM_PLIST(coeffs, i));
+        return;
+    }
+
+    case T_MACFLOAT: {
+        Double d = VAL_MACFLOAT(obj);
+        WriteTagAndIndex(w, TAG_MACFLOAT, obj);
+        WriteBytes(w, &d, sizeof(Double));
+        return;
+    }
+
+    case T_PERM2:
+        WriteTagAndIndex(w, TAG_PERM2, obj);
+        WriteUInt(w, DEG_PERM2(obj));
+        WriteBytes(w, CONST_ADDR_PERM2(obj), DEG_PERM2(obj) * sizeof(UInt2));
+        return;
+
+    case T_PERM4:
+        WriteTagAndIndex(w, TAG_PERM4, obj);
+        WriteUInt(w, DEG_PERM4(obj));
+        WriteBytes(w, CONST_ADDR_PERM4(obj), DEG_PERM4(obj) * sizeof(UInt4));
+        return;
+
+    case T_TRANS2:
+        WriteTagAndIndex(w, TAG_TRANS2, obj);
+        WriteUInt(w, DEG_TRANS2(obj));
+        WriteBytes(w, CONST_ADDR_TRANS2(obj), DEG_TRANS2(obj) * sizeof(UInt2));
+        return;
+
+    case T_TRANS4:
+        WriteTagAndIndex(w, TAG_TRANS4, obj);
+        WriteUInt(w, DEG_TRANS4(obj));
+        WriteBytes(w, CONST_ADDR_TRANS4(obj), DEG_TRANS4(obj) * sizeof(UInt4));
+        return;
+
+    case T_PPERM2:
+        WriteTagAndIndex(w, TAG_PPERM2, obj);
+        WriteUInt(w, DEG_PPERM2(obj));
+        WriteUInt(w, CODEG_PPERM2(obj));
+        WriteBytes(w, CONST_ADDR_PPERM2(obj), DEG_PPERM2(obj) * sizeof(UInt2));
+        return;
+
+    case T_PPERM4:
+        WriteTagAndIndex(w, TAG_PPERM4, obj);
+        WriteUInt(w, DEG_PPERM4(obj));
+        WriteUInt(w, CODEG_PPERM4(obj));
+        WriteBytes(w, CONST_ADDR_PPERM4(obj), DEG_PPERM4(obj) * sizeof(UInt4));
+        return;
+
+    case T_CHAR:
+        WriteByte(w, TAG_CHAR);
+        WriteByte(w, GAP_ValueOfChar(obj));
+        return;
+
+    case T_DATOBJ:
+        if (HasFilter(IsGF2VectorRep, obj)) {
+            WriteGF2Vec(w, obj);
+            return;
+        }
+        if (HasFilter(Is8BitVectorRep, obj)) {
+            WriteVec8Bit(w, obj);
+            return;
+        }
+        break;
+
+    case T_POSOBJ:
+        if (HasFilter(IsGF2MatrixRep, obj)) {
+            WriteCompressedMat(w, TAG_GF2MAT, obj);
+            return;
+        }
+        if (HasFilter(Is8BitMatrixRep, obj)) {
+            WriteCompressedMat(w, TAG_MAT8BIT, obj);
+            return;
+        }
+        break;
+    }
+
+    if (IS_PREC(obj)) {
+        UInt len = LEN_PREC(obj);
+        WriteTagAndIndex(w, TAG_PREC, obj);
+        WriteByte(w, IS_MUTABLE_OBJ(obj) ? 0 : FLAG_IMMUTABLE);
+        WriteUInt(w, len);
+        for (UInt i = 1; i <= len; i++) {
+            Int rnam = GET_RNAM_PREC(obj, i);
+            Obj name = NAME_RNAM(rnam < 0 ? -rnam : rnam);
+            WriteUInt(w, GET_LEN_STRING(name));
+            WriteBytes(w, CONST_CHARS_STRING(name), GET_LEN_STRING(name));
+            WriteObj(w, GET_ELM_PREC(obj, i));
+        }
+        return;
+    }
+
+    if (IS_LIST(obj)) {
+        UInt1 flags = IS_MUTABLE_OBJ(obj) ? 0 : FLAG_IMMUTABLE;
+        if (IS_STRING_REP(obj)) {
+            WriteTagAndIndex(w, TAG_STRING, obj);
+            WriteByte(w, flags);
+            WriteUInt(w, GET_LEN_STRING(obj));
+            WriteBytes(w, CONST_CHARS_STRING(obj), GET_LEN_STRING(obj));
+            return;
+        }
+        if (IS_BLIST_REP(obj)) {
+            WriteTagAndIndex(w, TAG_BLIST, obj);
+            WriteByte(w, flags);
+            WriteUInt(w, LEN_BLIST(obj));
+            WriteBytes(w, CONST_BLOCKS_BLIST(obj),
+                       NUMBER_BLOCKS_BLIST(obj) * sizeof(UInt));
+            return;
+        }
+        if (IS_RANGE(obj)) {
+            WriteTagAndIndex(w, TAG_RANGE, obj);
+            WriteByte(w, flags);
+            WriteUInt(w, GET_LEN_RANGE(obj));
+            WriteInt(w, GET_LOW_RANGE(obj));
+            WriteInt(w, GET_INC_RANGE(obj));
+            return;
+        }
+        if (IS_PLIST(obj)) {
+            UInt len = LEN_PLIST(obj);
+            if (HAS_FILT_LIST(obj, FN_IS_SSORT))
+                flags |= FLAG_SSORT;
+            WriteTagAndIndex(w, TAG_PLIST, obj);
+            WriteByte(w, flags);
+            WriteUInt(w, len);
+            for (UInt i = 1; i <= len; i++)
+                WriteObj(w, ELM_PLIST(obj, i));
+            return;
+        }
+    }
+
+    ErrorMayQuit("cannot serialize objects of type %s", (Int)TNAM_OBJ(obj), 0);
+}
+
+Obj gap_serialize(Obj obj)
+{
+    Writer w;
+    BEGIN_GAP_SYNC();
+    w.buf = NEW_STRING(0);
+    w.len = 0;
+    w.seen = NewObjMap();
+    w.count = 0;
+
+    WriteBytes(&w, SerializeMagic, sizeof(SerializeMagic));
+    WriteByte(&w, SERIALIZE_VERSION);
+    WriteByte(&w, sizeof(UInt));
+    WriteObj(&w, obj);
+
+    SET_LEN_STRING(w.buf, w.len);
+    SHRINK_STRING(w.buf);
+    END_GAP_SYNC();
+    return w.buf;
+}
+
+
+/****************************************************************************
+**
+**  Reading
+*/
+
+typedef struct {
+    const UInt1 * data;
+    UInt          len;
+    UInt          pos;
+    Obj           objs;    // plist of the objects read so far, by index
+    UInt          count;   // number of indexed objects
+    Obj           ssort;   // plist of lists stored as strictly sorted
+} Reader;
+
+static NOINLINE void ReadError(void)
+{
+    ErrorMayQuit("invalid or truncated serialized GAP object", 0, 0);
+}
+
+static const UInt1 * ReadBytes(Reader * r, UInt n)
+{
+    if (n > r->len - r->pos)
+        ReadError();
+    const UInt1 * p = r->data + r->pos;
+    r->pos += n;
+    return p;
+}
+
+static UInt1 ReadByte(Reader * r)
+{
+    return *ReadBytes(r, 1);
+}
+
+static UInt ReadUInt(Reader * r)
+{
+    UInt n = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        UInt1 b = ReadByte(r);
+        n |= (UInt)(b & 0x7f) << shift;
+        if (!(b & 0x80))
+            return n;
+    }
+    ReadError();
+    return 0;
+}
+
+static Int ReadInt(Reader * r)
+{
+    Int n;
+    memcpy(&n, ReadBytes(r, sizeof(Int)), sizeof(Int));
+    return n;
+}
+
+// Reserve the next index for an object that is about to be read.
+static UInt ReserveIndex(Reader * r)
+{
+    return ++r->count;
+}
+
+static void RegisterObj(Reader * r, UInt index, Obj obj)
+{
+    AssPlist(r->objs, index, obj);
+}
+
+// Read the flags of a list or record, which must be a subset of <allowed>.
+static UInt1 ReadFlags(Reader * r, UInt1 allowed)
+{
+    UInt1 flags = ReadByte(r);
+    if (flags & ~allowed)
+        ReadError();
+    return flags;
+}
+
+static void MakeImmutableIf(Obj obj, UInt1 flags)
+{
+    if (flags & FLAG_IMMUTABLE)
+        RetypeBag(obj, TNUM_OBJ(obj) | IMMUTABLE);
+}
+
+static Obj ReadObj(Reader * r);
+
+// Read an object that must not be a hole; holes are allowed only as
+// entries of plain lists.
+static Obj ReadValue(Reader * r)
+{
+    Obj obj = ReadObj(r);
+    if (obj == 0)
+        ReadError();
+    return obj;
+}
+
+static BOOL IsRational(Obj obj)
+{
+    return IS_INT(obj) || TNUM_OBJ(obj) == T_RAT;
+}
+
+// Check that the limbs of the large integer <obj> are normalized, that is,
+// the leading limb is nonzero and the value is not a small integer.
+static void CheckLargeInt(Obj obj)
+{
+    UInt         n = SIZE_INT(obj);
+    const UInt * limbs = CONST_ADDR_INT(obj);
+    if (limbs[n - 1] == 0)
+        ReadError();
+    if (n == 1) {
+        UInt max = (TNUM_OBJ(obj) == T_INTPOS) ? (UInt)INT_INTOBJ_MAX
+                                               : (UInt)INT_INTOBJ_MAX + 1;
+        if (limbs[0] <= max)
+            ReadError();
+    }
+}
+
+// Check that <num> / <den> is a valid rational in reduced form that is
+// not an integer.
+static void CheckRatParts(Obj num, Obj den)
+{
+    if (!IS_INT(num) || num == INTOBJ_INT(0) || !IS_POS_INT(den) ||
+        den == INTOBJ_INT(1))
+        ReadError();
+    if (GcdInt(num, den) != INTOBJ_INT(1))
+        ReadError();
+}
+
+// Return the <i>-th entry of the array <img> of UInt2 resp. UInt4 values,
+// depending on <width>.
+static UInt4 ImageAt(const void * img, UInt width, UInt i)
+{
+    return (width == 2) ? ((const UInt2 *)img)[i] : ((const UInt4 *)img)[i];
+}
+
+static int CompareUInt4(const void * a, const void * b)
+{
+    UInt4 x = *(const UInt4 *)a;
+    UInt4 y = *(const UInt4 *)b;
+    return (x > y) - (x < y);
+}
+
+// Check that the <n> entries of <img> are pairwise distinct, ignoring
+// zeros if <skipZero> is set. <buf> must be a string with room for <n>
+// UInt4 values; it must be allocated before <img> is computed, since the
+// allocation may move bags.
+static void
+CheckDistinct(const void * img, UInt width, UInt n, BOOL skipZero, Obj buf)
+{
+    UInt4 * vals = (UInt4 *)CHARS_STRING(buf);
+    UInt    k = 0;
+    for (UInt i = 0; i < n; i++) {
+        UInt4 v = ImageAt(img, width, i);
+        if (v != 0 || !skipZero)
+            vals[k++] = v;
+    }
+    qsort(vals, k, sizeof(UInt4), CompareUInt4);
+    for (UInt i = 1; i < k; i++) {
+        if (vals[i - 1] == vals[i])
+            ReadError();
+    }
+}
+
+// Check that the <n> images of a permutation are a permutation of
+// 0, ..., n-1.
+static void CheckPermImages(const void * img, UInt width, UInt n, Obj buf)
+{
+    for (UInt i = 0; i < n; i++) {
+        if (ImageAt(img, width, i) >= n)
+            ReadError();
+    }
+    CheckDistinct(img, width, n, 0, buf);
+}
+
+// Check that the <n> images of a transformation lie in 0, ..., n-1.
+static void CheckTransImages(const void * img, UInt width, UInt n)
+{
+    for (UInt i = 0; i < n; i++) {
+        if (ImageAt(img, width, i) >= n)
+            ReadError();
+    }
+}
+
+// Check that the <n> images of a partial permutation are injective on the
+// points with nonzero image, that the image of the last point is nonzero,
+// and that <codeg> is the largest image.
+static void
+CheckPPermImages(const void * img, UInt width, UInt n, UInt codeg, Obj buf)
+{
+    UInt max = 0;
+    for (UInt i = 0; i < n; i++) {
+        UInt v = ImageAt(img, width, i);
+        if (v > max)
+            max = v;
+    }
+    if (max != codeg || (n > 0 && ImageAt(img, width, n - 1) == 0))
+        ReadError();
+    CheckDistinct(img, width, n, 1, buf);
+}
+
+// Check that the bits after the first <len> ones in <blocks> are zero.
+static void CheckTrailingBits(const UInt * blocks, UInt len)
+{
+    if (len % BIPEB != 0 && (blocks[len / BIPEB] >> (len % BIPEB)) != 0)
+        ReadError();
+}
+
+// Return whether <q> is the size of a field for 8-bit vectors.
+static BOOL IsVec8BitFieldSize(UInt q)
+{
+    if (q < 3 || q > 256)
+        return 0;
+    UInt p = 2;
+    while (q % p != 0)
+        p++;
+    while (q % p == 0)
+        q /= p;
+    return q == 1;
+}
+
+// Read the data of a word-sized data object, after its type; the data
+// must consist of at least <min> bytes.
+static Obj ReadDatObjData(Reader * r, UInt min)
+{
+    UInt size = ReadUInt(r);
+    if (size < min || size > r->len - r->pos)
+        ReadError();
+    Obj obj = NewBag(T_DATOBJ, size + sizeof(Obj));
+    memcpy(ADDR_OBJ(obj) + 1, ReadBytes(r, size), size);
+    return obj;
+}
+
+// Return the small nonnegative integer stored in the data object <obj> at
+// position <pos>.
+static UInt DatObjLength(Obj obj, UInt pos)
+{
+    Obj val = CONST_ADDR_OBJ(obj)[pos];
+    if (!IS_INTOBJ(val) || INT_INTOBJ(val) < 0)
+        ReadError();
+    return INT_INTOBJ(val);
+}
+
+// Read a GF(2) vector, consisting of its length and its bits.
+static Obj ReadGF2VecData(Reader * r)
+{
+    Obj  obj = ReadDatObjData(r, sizeof(Obj));
+    UInt len = DatObjLength(obj, 1);
+    if (len > (SIZE_OBJ(obj) / sizeof(UInt)) * BIPEB ||
+        SIZE_OBJ(obj) < SIZE_PLEN_GF2VEC(len))
+        ReadError();
+    CheckTrailingBits(CONST_BLOCKS_GF2VEC(obj), len);
+    return obj;
+}
+
+// Read an 8-bit vector over the field with <q> elements, consisting of
+// its length, its field size, and its bytes.
+static Obj ReadVec8BitData(Reader * r, UInt q)
+{
+    if (!IsVec8BitFieldSize(q))
+        ReadError();
+    Obj  obj = ReadDatObjData(r, 2 * sizeof(Obj));
+    UInt len = DatObjLength(obj, 1);
+    if (DatObjLength(obj, 2) != q)
+        ReadError();
+
+    Obj  info = GetFieldInfo8Bit(q);
+    UInt elts = ELS_BYTE_FIELDINFO_8BIT(info);
+    if (len > SIZE_OBJ(obj) * elts || SIZE_OBJ(obj) < SIZE_VEC8BIT(len, elts))
+        ReadError();
+
+    // each byte stores <elts> entries as the digits of a number in base
+    // <q>; the unused digits and bytes must be zero
+    const UInt1 * bytes = CONST_BYTES_VEC8BIT(obj);
+    UInt          nbytes = SIZE_OBJ(obj) - 3 * sizeof(UInt);
+    UInt          full = len / elts;
+    UInt          bound = 1;
+    for (UInt k = 0; k < elts; k++)
+        bound *= q;
+    for (UInt i = 0; i < nbytes; i++) {
+        if (i == full) {
+            bound = 1;
+            for (UInt k = 0; k < len % elts; k++)
+                bound *= q;
+        }
+        else if (i == full + 1) {
+            bound = 1;
+        }
+        if (bytes[i] >= bound)
+            ReadError();
+    }
+    return obj;
+}
+
+static Obj ReadCompressedMat(Reader * r, UInt1 tag)
+{
+    UInt  index = ReserveIndex(r);
+    UInt1 flags = ReadFlags(r, FLAG_IMMUTABLE);
+    UInt  q = (tag == TAG_MAT8BIT) ? ReadUInt(r) : 2;
+    UInt  len = ReadUInt(r);
+    if (len == 0 || len > r->len - r->pos)
+        ReadError();
+    if (tag == TAG_MAT8BIT && !IsVec8BitFieldSize(q))
+        ReadError();
+
+    Obj mat = NewBag(T_POSOBJ, (len + 2) * sizeof(Obj));
+    ADDR_OBJ(mat)[1] = INTOBJ_INT(len);
+    RegisterObj(r, index, mat);
+
+    BOOL mut = !(flags & FLAG_IMMUTABLE);
+    Obj  rowtype = (tag == TAG_GF2MAT)
+                       ? (mut ? TYPE_LIST_GF2VEC_LOCKED
+                              : TYPE_LIST_GF2VEC_IMM_LOCKED)
+                       : CALL_2ARGS(TYPE_VEC8BIT_LOCKED, INTOBJ_INT(q),
+                                    mut ? True : False);
+    UInt ncols = 0;
+    for (UInt i = 1; i <= len; i++) {
+        // the rows must be vectors over the field of the matrix,
+        // all of the same length
+        Obj row = ReadValue(r);
+        if (!IS_BAG_REF(row) || TNUM_OBJ(row) != T_DATOBJ)
+            ReadError();
+        UInt rowlen;
+        if (tag == TAG_GF2MAT) {
+            if (!HasFilter(IsGF2VectorRep, row))
+                ReadError();
+            rowlen = LEN_GF2VEC(row);
+        }
+        else {
+            if (!HasFilter(Is8BitVectorRep, row) ||
+                FIELD_VEC8BIT(row) != q)
+                ReadError();
+            rowlen = LEN_VEC8BIT(row);
+        }
+        if (i == 1)
+            ncols = rowlen;
+        else if (rowlen != ncols)
+            ReadError();
+        SetTypeDatObj(row, rowtype);
+        ADDR_OBJ(mat)[i + 1] = row;
+        CHANGED_BAG(mat);
+    }
+
+    Obj type = (tag == TAG_GF2MAT)
+                   ? (mut ? TYPE_LIST_GF2MAT : TYPE_LIST_GF2MAT_IMM)
+                   : CALL_2ARGS(TYPE_MAT8BIT, INTOBJ_INT(q),
+                                mut ? True : False);
+    SET_TYPE_POSOBJ(mat, type);
+    CHANGED_BAG(mat);
+    return mat;
+}
+
+static Obj ReadObj(Reader * r)
+{
+    UInt1 tag = ReadByte(r);
+    UInt  index, n;
+    UInt1 flags;
+    Obj   obj;
+
+    switch (tag) {
+    case TAG_HOLE:
+        // the callers reject holes where they are not allowed
+        return 0;
+
+    case TAG_INTOBJ: {
+        Int v = ReadInt(r);
+        if (v < INT_INTOBJ_MIN || v > INT_INTOBJ_MAX)
+            ReadError();
+        return INTOBJ_INT(v);
+    }
+
+    case TAG_FFE: {
+        UInt p = ReadUInt(r);
+        UInt d = ReadUInt(r);
+        UInt v = ReadUInt(r);
+        if (p < 2 || d < 1 || d > 16)
+            ReadError();
+        FF fld = FiniteField(p, d);
+        if (fld == 0 || CHAR_FF(fld) != p || DEGR_FF(fld) != d ||
+            v >= SIZE_FF(fld))
+            ReadError();
+        return NEW_FFE(fld, v);
+    }
+
+    case TAG_TRUE:
+        return True;
+    case TAG_FALSE:
+        return False;
+    case TAG_FAIL:
+        return Fail;
+
+    case TAG_CHAR:
+        return GAP_CharWithValue(ReadByte(r));
+
+    case TAG_BACKREF:
+        n = ReadUInt(r);
+        if (n == 0 || n > LEN_PLIST(r->objs) || ELM_PLIST(r->objs, n) == 0)
+            ReadError();
+        return ELM_PLIST(r->objs, n);
+
+    case TAG_INTPOS:
+    case TAG_INTNEG:
+        index = ReserveIndex(r);
+        n = ReadUInt(r);
+        if (n == 0 || n > (r->len - r->pos) / sizeof(UInt))
+            ReadError();
+        obj = NewBag(tag == TAG_INTPOS ? T_INTPOS : T_INTNEG,
+                     n * sizeof(UInt));
+        memcpy(ADDR_INT(obj), ReadBytes(r, n * sizeof(UInt)),
+               n * sizeof(UInt));
+        CheckLargeInt(obj);
+        break;
+
+    case TAG_RAT: {
+        index = ReserveIndex(r);
+        Obj num = ReadValue(r);
+        Obj den = ReadValue(r);
+        CheckRatParts(num, den);
+        obj = NewBag(T_RAT, 2 * sizeof(Obj));
+        ADDR_OBJ(obj)[0] = num;
+        ADDR_OBJ(obj)[1] = den;
+        CHANGED_BAG(obj);
+        break;
+    }
+
+    case TAG_CYC: {
+        index = ReserveIndex(r);
+        n = ReadUInt(r);
+        if (n == 0 || n > r->len - r->pos)
+            ReadError();
+        Obj coeffs = NEW_PLIST(T_PLIST, n);
+        SET_LEN_PLIST(coeffs, n);
+        for (UInt i = 1; i <= n; i++) {
+            Obj c = ReadValue(r);
+            if (!IsRational(c))
+                ReadError();
+            SET_ELM_PLIST(coeffs, i, c);
+            CHANGED_BAG(coeffs);
+        }
+        obj = CALL_1ARGS(CycList, coeffs);
+        break;
+    }
+
+    case TAG_MACFLOAT: {
+        Double d;
+        index = ReserveIndex(r);
+        memcpy(&d, ReadBytes(r, sizeof(Double)), sizeof(Double));
+        obj = NEW_MACFLOAT(d);
+        break;
+    }
+
+    case TAG_PERM2: {
+        index = ReserveIndex(r);
+        n = ReadUInt(r);
+        if (n > (r->len - r->pos) / sizeof(UInt2))
+            ReadError();
+        Obj buf = NEW_STRING(n * sizeof(UInt4));
+        obj = NEW_PERM2(n);
+        memcpy(ADDR_PERM2(obj), ReadBytes(r, n * sizeof(UInt2)),
+               n * sizeof(UInt2));
+        CheckPermImages(ADDR_PERM2(obj), 2, n, buf);
+        break;
+    }
+
+    case TAG_PERM4: {
+        index = ReserveIndex(r);
+        n = ReadUInt(r);
+        if (n > (r->len - r->pos) / sizeof(UInt4))
+            ReadError();
+        Obj buf = NEW_STRING(n * sizeof(UInt4));
+        obj = NEW_PERM4(n);
+        memcpy(ADDR_PERM4(obj), ReadBytes(r, n * sizeof(UInt4)),
+               n * sizeof(UInt4));
+        CheckPermImages(ADDR_PERM4(obj), 4, n, buf);
+        break;
+    }
+
+    case TAG_TRANS2:
+        index = ReserveIndex(r);
+        n = ReadUInt(r);
+        if (n > (r->len - r->pos) / sizeof(UInt2))
+            ReadError();
+        obj = NEW_TRANS2(n);
+        memcpy(ADDR_TRANS2(obj), ReadBytes(r, n * sizeof(UInt2)),
+               n * sizeof(UInt2));
+        CheckTransImages(ADDR_TRANS2(obj), 2, n);
+        break;
+
+    case TAG_TRANS4:
+        index = ReserveIndex(r);
+        n = ReadUInt(r);
+        if (n > (r->len - r->pos) / sizeof(UInt4))
+            ReadError();
+        obj = NEW_TRANS4(n);
+        memcpy(ADDR_TRANS4(obj), ReadBytes(r, n * sizeof(UInt4)),
+               n * sizeof(UInt4));
+        CheckTransImages(ADDR_TRANS4(obj), 4, n);
+        break;
+
+    case TAG_PPERM2: {
+        index = ReserveIndex(r);
+        n = ReadUInt(r);
+        UInt codeg = ReadUInt(r);
+        if (n > (r->len - r->pos) / sizeof(UInt2))
+            ReadError();
+        Obj buf = NEW_STRING(n * sizeof(UInt4));
+        obj = NEW_PPERM2(n);
+        SET_CODEG_PPERM2(obj, codeg);
+        memcpy(ADDR_PPERM2(obj), ReadBytes(r, n * sizeof(UInt2)),
+               n * sizeof(UInt2));
+        CheckPPermImages(ADDR_PPERM2(obj), 2, n, codeg, buf);
+        break;
+    }
+
+    case TAG_PPERM4: {
+        index = ReserveIndex(r);
+        n = ReadUInt(r);
+        UInt codeg = ReadUInt(r);
+        if (n > (r->len - r->pos) / sizeof(UInt4))
+            ReadError();
+        Obj buf = NEW_STRING(n * sizeof(UInt4));
+        obj = NEW_PPERM4(n);
+        SET_CODEG_PPERM4(obj, codeg);
+        memcpy(ADDR_PPERM4(obj), ReadBytes(r, n * sizeof(UInt4)),
+               n * sizeof(UInt4));
+        CheckPPermImages(ADDR_PPERM4(obj), 4, n, codeg, buf);
+        break;
+    }
+
+    case TAG_STRING:
+        index = ReserveIndex(r);
+        flags = ReadFlags(r, FLAG_IMMUTABLE);
+        n = ReadUInt(r);
+        if (n > r->len - r->pos)
+            ReadError();
+        obj = NEW_STRING(n);
+        memcpy(CHARS_STRING(obj), ReadBytes(r, n), n);
+        MakeImmutableIf(obj, flags);
+        break;
+
+    case TAG_BLIST:
+        index = ReserveIndex(r);
+        flags = ReadFlags(r, FLAG_IMMUTABLE);
+        n = ReadUInt(r);
+        if (n / BIPEB > r->len - r->pos)
+            ReadError();
+        obj = NEW_BLIST(n);
+        memcpy(BLOCKS_BLIST(obj),
+               ReadBytes(r, NUMBER_BLOCKS_BLIST(obj) * sizeof(UInt)),
+               NUMBER_BLOCKS_BLIST(obj) * sizeof(UInt));
+        CheckTrailingBits(CONST_BLOCKS_BLIST(obj), n);
+        MakeImmutableIf(obj, flags);
+        break;
+
+    case TAG_RANGE: {
+        index = ReserveIndex(r);
+        flags = ReadFlags(r, FLAG_IMMUTABLE);
+        n = ReadUInt(r);
+        Int low = ReadInt(r);
+        Int inc = ReadInt(r);
+        // all entries must be small integers
+        if (n == 0 || inc == 0 || low < INT_INTOBJ_MIN ||
+            low > INT_INTOBJ_MAX || inc < INT_INTOBJ_MIN ||
+            inc > INT_INTOBJ_MAX ||
+            n - 1 > (UInt)(INT_INTOBJ_MAX - INT_INTOBJ_MIN) /
+                        (UInt)(inc < 0 ? -inc : inc))
+            ReadError();
+        Int high = low + (Int)(n - 1) * inc;
+        if (high < INT_INTOBJ_MIN || high > INT_INTOBJ_MAX)
+            ReadError();
+        obj = NEW_RANGE(n, low, inc);
+        MakeImmutableIf(obj, flags);
+        break;
+    }
+
+    case TAG_PLIST:
+        index = ReserveIndex(r);
+        flags = ReadFlags(r, FLAG_IMMUTABLE | FLAG_SSORT);
+        n = ReadUInt(r);
+        if (n > r->len - r->pos)
+            ReadError();
+        obj = NEW_PLIST(T_PLIST, n);
+        SET_LEN_PLIST(obj, n);
+        // register before reading the entries, to support cycles
+        RegisterObj(r, index, obj);
+        for (UInt i = 1; i <= n; i++) {
+            Obj elm = ReadObj(r);
+            // the last entry of a plain list is bound,
+            // and strictly sorted lists are dense
+            if (elm == 0 && (i == n || (flags & FLAG_SSORT)))
+                ReadError();
+            SET_ELM_PLIST(obj, i, elm);
+            CHANGED_BAG(obj);
+        }
+        if (n == 0)
+            RetypeBag(obj, T_PLIST_EMPTY);
+        MakeImmutableIf(obj, flags);
+        // the flag is verified by GAP once all objects are complete,
+        // see 'gap_deserialize'
+        if (n > 1 && (flags & FLAG_SSORT))
+            AssPlist(r->ssort, LEN_PLIST(r->ssort) + 1, obj);
+        return obj;
+
+    case TAG_PREC:
+        index = ReserveIndex(r);
+        flags = ReadFlags(r, FLAG_IMMUTABLE);
+        n = ReadUInt(r);
+        if (n > r->len - r->pos)
+            ReadError();
+        obj = NEW_PREC(n);
+        RegisterObj(r, index, obj);
+        for (UInt i = 1; i <= n; i++) {
+            UInt len = ReadUInt(r);
+            if (len > r->len - r->pos)
+                ReadError();
+            Obj name = MakeStringWithLen((const char *)ReadBytes(r, len), len);
+            UInt rnam = RNamObj(name);
+            AssPRec(obj, rnam, ReadValue(r));
+        }
+        MakeImmutableIf(obj, flags);
+        return obj;
+
+    case TAG_GF2VEC:
+        index = ReserveIndex(r);
+        flags = ReadFlags(r, FLAG_IMMUTABLE);
+        obj = ReadGF2VecData(r);
+        SetTypeDatObj(obj, (flags & FLAG_IMMUTABLE) ? TYPE_LIST_GF2VEC_IMM
+                                                    : TYPE_LIST_GF2VEC);
+        break;
+
+    case TAG_VEC8BIT: {
+        index = ReserveIndex(r);
+        flags = ReadFlags(r, FLAG_IMMUTABLE);
+        UInt q = ReadUInt(r);
+        obj = ReadVec8BitData(r, q);
+        SetTypeDatObj(obj, CALL_2ARGS(TYPE_VEC8BIT, INTOBJ_INT(q),
+                                      (flags & FLAG_IMMUTABLE) ? False
+                                                               : True));
+        break;
+    }
+
+    case TAG_GF2MAT:
+    case TAG_MAT8BIT:
+        return ReadCompressedMat(r, tag);
+
+    default:
+        ReadError();
+        return 0;
+    }
+
+    RegisterObj(r, index, obj);
+    return obj;
+}
+
+Obj gap_deserialize(const UInt1 * data, UInt len)
+{
+    Reader r;
+    BEGIN_GAP_SYNC();
+    r.data = data;
+    r.len = len;
+    r.pos = 0;
+    r.objs = NEW_PLIST(T_PLIST, 0);
+    r.count = 0;
+    r.ssort = NEW_PLIST(T_PLIST, 0);
+
+    const UInt1 * magic = ReadBytes(&r, sizeof(SerializeMagic));
+    if (memcmp(magic, SerializeMagic, sizeof(SerializeMagic)) != 0)
+        ErrorMayQuit("data is not a serialized GAP object", 0, 0);
+    if (ReadByte(&r) != SERIALIZE_VERSION)
+        ErrorMayQuit("unsupported version of serialized GAP object", 0, 0);
+    if (ReadByte(&r) != sizeof(UInt))
+        ErrorMayQuit("serialized GAP object has incompatible limb size", 0,
+                     0);
+
+    Obj obj = ReadValue(&r);
+    if (r.pos != r.len)
+        ReadError();
+
+    // let GAP check (and store) that the lists stored as strictly sorted
+    // are strictly sorted, now that their entries are complete
+    for (UInt i = 1; i <= LEN_PLIST(r.ssort); i++) {
+        if (!IS_SSORT_LIST(ELM_PLIST(r.ssort, i)))
+            ReadError();
+    }
+    END_GAP_SYNC();
+    return obj;
+}
+
+void InitSerialize(void)
+{
+    InitFopyGVar("COEFFS_CYC", &COEFFS_CYC);
+    InitFopyGVar("CycList", &CycList);
+    InitFopyGVar("Q_VEC8BIT", &Q_VEC8BIT);
+    InitFopyGVar("TYPE_VEC8BIT", &TYPE_VEC8BIT);
+    InitFopyGVar("TYPE_VEC8BIT_LOCKED", &TYPE_VEC8BIT_LOCKED);
+    InitFopyGVar("TYPE_MAT8BIT", &TYPE_MAT8BIT);
+    InitCopyGVar("TYPE_LIST_GF2VEC", &TYPE_LIST_GF2VEC);
+    InitCopyGVar("TYPE_LIST_GF2VEC_IMM", &TYPE_LIST_GF2VEC_IMM);
+    InitCopyGVar("TYPE_LIST_GF2VEC_LOCKED", &TYPE_LIST_GF2VEC_LOCKED);
+    InitCopyGVar("TYPE_LIST_GF2VEC_IMM_LOCKED", &TYPE_LIST_GF2VEC_IMM_LOCKED);
+    InitCopyGVar("TYPE_LIST_GF2MAT", &TYPE_LIST_GF2MAT);
+    InitCopyGVar("TYPE_LIST_GF2MAT_IMM", &TYPE_LIST_GF2MAT_IMM);
+    InitCopyGVar("IsGF2VectorRep", &IsGF2VectorRep);
+    InitCopyGVar("Is8BitVectorRep", &Is8BitVectorRep);
+    InitCopyGVar("IsGF2MatrixRep", &IsGF2MatrixRep);
+    InitCopyGVar("Is8BitMatrixRep", &Is8BitMatrixRep);
+}
@@ -0,0 +1,33 @@
+//
+//  This file is part of GAP.jl, a bidirectional interface between Julia and
+//  the GAP computer algebra system.
+//
+//  Copyright of GAP.jl and its parts belongs to its developers.
+//  Please refer to its README.md file for details.
+//
+//  SPDX-License-Identifier: LGPL-3.0-or-later
+//
+// Binary serialization of GAP objects.
+
+#ifndef JULIAINTERFACE_SERIALIZE_H
+#define JULIAINTERFACE_SERIALIZE_H
+
+#include <gap_all.h>    // GAP headers
+
+// Return a GAP string containing the binary serialization of <obj>.
+// Identical subobjects are stored only once, so sharing and cycles are
+// preserved.
+//
+// This function is used by GAP.jl
+Obj gap_serialize(Obj obj);
+
+// Return the GAP object whose serialization is stored in the <len> bytes
+// starting at <data>.
+//
+// This function is used by GAP.jl
+Obj gap_deserialize(const UInt1 * data, UInt len);
+
+// Initialize the copies of GAP variables needed for serialization.
+void InitSerialize(void);
+
+#endif
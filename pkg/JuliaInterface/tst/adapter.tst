@@ -139,6 +139,23 @@ gap> foo.bar := 42;
 42
 gap> foo;
 <Julia: Foo(42)>
+gap> \.( foo, RNamObj( "bar" ) );
+42
+gap> \.\:\=( foo, RNamObj( "bar" ), 17 );
+gap> foo.bar;
+17
+
+# more specific methods for '\.' are respected
+gap> DeclareCategory( "IsJuliaObjectForAdapterTest", IsJuliaObject );
+gap> InstallOtherMethod( \.,
+>        [ "IsJuliaObjectForAdapterTest", "IsPosInt and IsSmallIntRep" ],
+>        { obj, rnam } -> Concatenation( "special ", NameRNam( rnam ) ) );
+gap> obj:= Objectify( NewType( NewFamily( "JuliaObjectForAdapterTestFamily" ),
+>            IsJuliaObjectForAdapterTest and IsComponentObjectRep ), rec() );;
+gap> obj.bar;
+"special bar"
+gap> foo.bar;
+17
 
 #
 # use Julia's random sources
@@ -9,7 +9,7 @@
 ##  SPDX-License-Identifier: LGPL-3.0-or-later
 ##
 #@local f,f0,f1,f2,f3,f4,f5,f6,f7,fw,f0w,f1w,f2w,f3w,f4w,f5w,f6w,f7w
-#@local g0,g1,g2,g3,g4,g5,g6,g7,h0,h1,h2,h3,h4,h5,h6
+#@local g0,g1,g2,g3,g4,g5,g6,g7,h0,h1,h2,h3,h4,h5,h6,T
 gap> START_TEST( "calls.tst" );
 
 #
@@ -213,5 +213,18 @@ gap> h4 := JuliaEvalString("function h4(a,b,c,d) end");;
 gap> h5 := JuliaEvalString("function h5(a,b,c,d,e) end");;
 gap> h6 := JuliaEvalString("function h6(a,b,c,d,e,f) end");;
 
+#
+# calls of Julia objects which are not functions
+#
+gap> T := JuliaEvalString("Pair");;
+gap> T(1, 2);
+<Julia: 1 => 2>
+gap> CallFuncList(T, [ 1, 2 ]);
+<Julia: 1 => 2>
+gap> CallFuncList(f, [ 1,, 3 ]);
+<Julia: (1, nothing, 3)>
+gap> CallFuncList(f, [ 1 .. 3 ]);
+<Julia: (1, 2, 3)>
+
 #
 gap> STOP_TEST( "calls.tst" );
@@ -22,10 +22,26 @@ gap> CallJuliaFunctionWithCatch( Julia.Base.sqrt, [ 4 ], rec() );
 rec( ok := true, value := <Julia: 2.0> )
 gap> CallJuliaFunctionWithCatch( Julia.Base.sqrt, [ 4 ], fail );
 Error, usage: CallJuliaFunctionWithCatch( <julia_obj>, <args>[, <kwargs>] )
+gap> TryCallJuliaFunction( Julia.Base.sqrt, [ 4 ] );
+[ true, <Julia: 2.0> ]
+gap> res:= TryCallJuliaFunction( Julia.Base.sqrt, [ -1 ] );;
+gap> res[1];
+false
+gap> Julia.isa( res[2].exception, Julia.DomainError );
+true
+gap> StartsWith( JuliaToGAP( IsString, GAP_jl.error_message( res[2] ) ),
+>        "DomainError" );
+true
+gap> TryCallJuliaFunction( Julia.Base.range, [ 2, 10 ], rec( step:= 2 ) );
+[ true, <Julia: 2:2:10> ]
+gap> TryCallJuliaFunction( Julia.Base.sqrt, [ 4 ], fail );
+Error, usage: TryCallJuliaFunction( <julia_obj>, <args>[, <kwargs>] )
 
 ##
 gap> JuliaEvalString(fail);
 Error, JuliaEvalString: <string> must be a string (not the value 'fail')
+gap> JuliaEvalString("error(\"a Julia error\")");
+Error, a Julia error
 
 ##
 gap> Julia.Core.Tuple( GAPToJulia( JuliaType( Julia.Vector, [ Julia.Any ] ), [] ) );
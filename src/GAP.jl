@@ -254,6 +254,11 @@ function __init__()
     # Start GAP.
     initialize(cmdline_options)
 
+    # invalidate the numbers of record components from earlier sessions
+    _session_id[] = rand(UInt) | 1
+    empty!(_RNAM_SYMBOLS)
+    empty!(_SYMBOL_RNAMS)
+
     timeout = Globals.UserPreference(GapObj("utils"), GapObj("DownloadMaxTime"))
     if timeout == 0
       # The user did not set a non-default timeout.
@@ -347,8 +352,11 @@ include("conversion.jl")
 include("gap_to_julia.jl")
 include("constructors.jl")
 include("julia_to_gap.jl")
+include("integer_arrays.jl")
 
 include("utils.jl")
+include("interrupt.jl")
+include("serialization.jl")
 include("help.jl")
 include("prompt.jl")
 include("exec.jl")
@@ -356,5 +364,6 @@ include("doctestfilters.jl")
 
 include("GAP_pkg.jl")
 include("packages.jl")
+include("memoize.jl")
 
 end
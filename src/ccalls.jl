@@ -241,6 +241,29 @@ NEW_MACFLOAT(x::Float64) = @ccall libgap.NEW_MACFLOAT(x::Cdouble)::GapObj
 ValueMacFloat(x::GapObj) = @ccall libgap.GAP_ValueMacFloat(x::Any)::Cdouble
 CharWithValue(x::Cuchar) = @ccall libgap.GAP_CharWithValue(x::Cuchar)::GapObj
 
+# Vectors and matrices over GF(p^d) with p^d <= 65536, described by the values
+# of their entries as GAP FFEs, see `ffe.c` in JuliaInterface.
+# The columns of a `Matrix{UInt16}` correspond to the rows of the GAP matrix.
+function ffe_vector_from_values(vals::Vector{UInt16}, p::Int, d::Int)
+    return GC.@preserve vals @ccall JuliaInterface_path.gap_ffe_vector(pointer(vals)::Ptr{UInt16}, length(vals)::Culong, p::Culong, d::Culong)::GapObj
+end
+
+function ffe_matrix_from_values(vals::Matrix{UInt16}, p::Int, d::Int)
+    ncols, nrows = size(vals)
+    return GC.@preserve vals @ccall JuliaInterface_path.gap_ffe_matrix(pointer(vals)::Ptr{UInt16}, nrows::Culong, ncols::Culong, p::Culong, d::Culong)::GapObj
+end
+
+function ffe_vector_values!(vals::Vector{UInt16}, vec::GapObj, p::Int, d::Int)
+    GC.@preserve vals @ccall JuliaInterface_path.gap_ffe_vector_values(vec::GapObj, pointer(vals)::Ptr{UInt16}, length(vals)::Culong, p::Culong, d::Culong)::Cvoid
+    return vals
+end
+
+function ffe_matrix_values!(vals::Matrix{UInt16}, mat::GapObj, p::Int, d::Int)
+    ncols, nrows = size(vals)
+    GC.@preserve vals @ccall JuliaInterface_path.gap_ffe_matrix_values(mat::GapObj, pointer(vals)::Ptr{UInt16}, nrows::Culong, ncols::Culong, p::Culong, d::Culong)::Cvoid
+    return vals
+end
+
 # `WrapJuliaFunc` and `UnwrapJuliaFunc` are intended to create a GAP function
 # object that wraps a given Julia function, and to unwrap such a GAP function,
 # respectively.
@@ -262,6 +285,11 @@ WrapJuliaFunc(x::Function) = @ccall JuliaInterface_path.WrapJuliaFunc(x::Any)::G
 UnwrapJuliaFunc(x::Any) = x
 UnwrapJuliaFunc(x::GapObj) = @ccall JuliaInterface_path.UnwrapJuliaFunc(x::GapObj)::Any
 
+# Mark the nonempty dense plain list `list` as strictly sorted;
+# the caller is responsible for the correctness of this information.
+set_ssorted_plist!(list::GapObj) =
+    @ccall JuliaInterface_path.gap_set_ssorted_plist(list::GapObj)::Cvoid
+
 function ElmList(x::GapObj, position)
     o = @ccall libgap.GAP_ElmList(x::Any, Culong(position)::Culong)::Ptr{Cvoid}
     return _GAP_TO_JULIA(o)
@@ -446,6 +446,35 @@ julia> Tuple{GapObj,GapObj}(val)
 (::Type{T})(obj::GapObj; recursive::Bool = false) where {T<:Tuple} =
     gap_to_julia(T, obj; recursive)
 
+@doc """
+    NamedTuple{names,Types}(obj::GapObj; recursive::Bool = false)
+
+Return the named tuple converted from the
+[GAP record](GAP_ref(ref:Records)) `obj`.
+The entries are the values of the record components `names`,
+converted to the required types `Types...`;
+if `Types` is not given then the entries are converted as for `Any`.
+Further components of `obj` are ignored.
+If `recursive` is `true` then the entries are
+converted recursively, otherwise non-recursively.
+
+# Examples
+```jldoctest
+julia> val = GAP.evalstr("rec( a := 1, b := \\"abc\\", c := [ 1, 2 ] )")
+GAP: rec( a := 1, b := "abc", c := [ 1, 2 ] )
+
+julia> NamedTuple{(:a, :b),Tuple{Int,String}}(val)
+(a = 1, b = "abc")
+
+julia> NamedTuple{(:c,)}(val; recursive=true)
+(c = Any[1, 2],)
+
+```
+""" NamedTuple
+
+(::Type{T})(obj::GapObj; recursive::Bool = false) where {T<:NamedTuple} =
+    gap_to_julia(T, obj; recursive)
+
 @doc """
     UnitRange(obj::GapObj)
 
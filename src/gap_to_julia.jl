@@ -174,11 +174,12 @@ function gap_to_julia_internal(
     ::Val{recursive},
 ) where {TT <: Set, recursive}
 
-    if Wrappers.IsCollection(obj)
+    if Wrappers.IsList(obj)
+        # Duplicates get removed by `push!`, via hashing in Julia,
+        # thus GAP need not sort the list or remove duplicates.
+        newobj = obj
+    elseif Wrappers.IsCollection(obj)
         newobj = Wrappers.AsSet(obj)
-    elseif Wrappers.IsList(obj)
-        # The list entries may be not comparable via `<`.
-        newobj = Wrappers.DuplicateFreeList(obj)
     else
         throw(ConversionError(obj, TT))
     end
@@ -186,6 +187,7 @@ function gap_to_julia_internal(
     recursive && recursion_dict !== nothing && haskey(recursion_dict, (obj, TT)) && return recursion_dict[(obj, TT)]
 
     ret_val = TT()
+    sizehint!(ret_val, length(newobj))
 
     T = eltype(TT)
     rec = recursive && _needs_tracking_gap_to_julia(T)
@@ -194,6 +196,8 @@ function gap_to_julia_internal(
 
     for i = 1:length(newobj)
         current_obj = ElmList(newobj, i)
+        # skip holes
+        current_obj === nothing && continue
         if (rec || !(current_obj isa T)) && !isbitstype(typeof(current_obj))
             push!(ret_val, gap_to_julia_internal(T, current_obj, recursion_dict, BoolVal(rec)))
         else
@@ -203,76 +207,152 @@ function gap_to_julia_internal(
     return ret_val
 end
 
+# Return an expression that evaluates to `true` if one of `types` needs
+# tracking of subobjects.
+# (This is used in generated functions, thus it must be defined before them.)
+_any_needs_tracking_gap_to_julia(types) =
+    foldl((a, b) -> :($a || $b),
+          [:(_needs_tracking_gap_to_julia($T)) for T in types]; init = false)
+
 ## `Tuple`
 ## Note that the tuple type prescribes the types of the entries,
 ## thus we have to convert at least also the next layer,
 ## even if `recursive == false` holds.
-function gap_to_julia_internal(
+## For tuple types of fixed length, the code is generated for the given
+## entry types, thus the conversions of the entries are statically
+## dispatched and the result type can be inferred.
+@generated function gap_to_julia_internal(
     ::Type{TT},
     obj::GapObj,
     recursion_dict::JuliaCacheDict,
     ::Val{recursive},
 ) where {TT<:Tuple, recursive}
 
-    !Wrappers.IsList(obj) && throw(ConversionError(obj, TT))
-
-    # extract the Tuple parameters, i.e. from Tuple{T1, T2, ...}  the list T1,T2,...
-    parameters = TT.parameters
-    if length(parameters) == 0
-      # only the empty tuple is allowed
-      length(obj) == 0 && return ()
-      throw(ArgumentError("length of $obj does not match type $TT"))
+    if !(TT isa DataType)
+      return :(throw(ConversionError(obj, TT)))
+    elseif length(TT.parameters) > 0 && TT.parameters[end] isa Core.TypeofVararg
+      return :(_gap_to_julia_vararg_tuple(TT, obj, recursion_dict, Val(recursive)))
     end
 
-    len = length(parameters)
+    types = fieldtypes(TT)
+    N = length(types)
+    entries = [:(gap_to_julia_internal($(types[i]), obj[$i], rec_dict, BoolVal(rec)))
+               for i in 1:N]
 
-    if parameters[len] isa Core.TypeofVararg
-      # The last entry is `Vararg{S}` or `Vararg{S,N}` for some type `S`,
-      # meaning that the last entries of `obj` shall get converted to `S`.
-      S = parameters[len].T
-      if isdefined(parameters[len], :N)
-        length(obj) == len-1+parameters[len].N ||
-          throw(ArgumentError("length of $obj does not match type $TT"))
-      else
-        length(obj) >= len-1 ||
-          throw(ArgumentError("length of $obj does not match type $TT"))
-      end
+    return quote
+      !Wrappers.IsList(obj) && throw(ConversionError(obj, TT))
+      length(obj) == $N ||
+        throw(ArgumentError(string("length of ", obj, " does not match type ", TT)))
 
-      recursive && recursion_dict !== nothing && haskey(recursion_dict, (obj, TT)) && return recursion_dict[(obj, TT)]
+      recursive && recursion_dict !== nothing && haskey(recursion_dict, (obj, TT)) && return recursion_dict[(obj, TT)]::TT
 
       # Switch off recursion if none of the entry types needs recursion.
-      rec = recursive && (_needs_tracking_gap_to_julia(S) || any(X ->_needs_tracking_gap_to_julia(X), parameters[1:(len-1)]))
+      rec = recursive && $(_any_needs_tracking_gap_to_julia(types))
       rec_dict = recursion_info_j(TT, obj, rec, recursion_dict)
 
-      list = [
-        gap_to_julia_internal(parameters[i], obj[i], rec_dict, BoolVal(rec))
-        for i = 1:(len-1)
-      ]
-      append!(list, [gap_to_julia_internal(S, obj[i], rec_dict, BoolVal(rec)) for i in len:length(obj)])
+      ret_val = TT($(Expr(:tuple, entries...)))
+      handle_recursion((obj, TT), ret_val, rec, rec_dict)
+      return ret_val
+    end
+end
+
+## The last entry of the tuple type is `Vararg{S}` or `Vararg{S,N}` for
+## some type `S`, meaning that the last entries of `obj` shall get
+## converted to `S`.
+function _gap_to_julia_vararg_tuple(
+    ::Type{TT},
+    obj::GapObj,
+    recursion_dict::JuliaCacheDict,
+    ::Val{recursive},
+) where {TT<:Tuple, recursive}
+
+    !Wrappers.IsList(obj) && throw(ConversionError(obj, TT))
 
+    # extract the Tuple parameters, i.e. from Tuple{T1, T2, ...}  the list T1,T2,...
+    parameters = TT.parameters
+    len = length(parameters)
+
+    S = parameters[len].T
+    if isdefined(parameters[len], :N)
+      length(obj) == len-1+parameters[len].N ||
+        throw(ArgumentError("length of $obj does not match type $TT"))
     else
-      # The parameters correspond to the entries of `obj`.
-      length(obj) == len ||
+      length(obj) >= len-1 ||
         throw(ArgumentError("length of $obj does not match type $TT"))
+    end
 
-      recursive && recursion_dict !== nothing && haskey(recursion_dict, (obj, TT)) && return recursion_dict[(obj, TT)]
-
-      # Switch off recursion if none of the entry types needs recursion.
-      rec = recursive && any(X ->_needs_tracking_gap_to_julia(X), parameters[1:len])
+    recursive && recursion_dict !== nothing && haskey(recursion_dict, (obj, TT)) && return recursion_dict[(obj, TT)]
 
-      rec_dict = recursion_info_j(TT, obj, rec, recursion_dict)
+    # Switch off recursion if none of the entry types needs recursion.
+    rec = recursive && (_needs_tracking_gap_to_julia(S) || any(X ->_needs_tracking_gap_to_julia(X), parameters[1:(len-1)]))
+    rec_dict = recursion_info_j(TT, obj, rec, recursion_dict)
 
-      list = [
-        gap_to_julia_internal(parameters[i], obj[i], rec_dict, BoolVal(rec))
-        for i = 1:len
-      ]
-    end
+    list = [
+      gap_to_julia_internal(parameters[i], obj[i], rec_dict, BoolVal(rec))
+      for i = 1:(len-1)
+    ]
+    append!(list, [gap_to_julia_internal(S, obj[i], rec_dict, BoolVal(rec)) for i in len:length(obj)])
 
     ret_val = TT(list)
     handle_recursion((obj, TT), ret_val, rec, rec_dict)
     return ret_val
 end
 
+## `NamedTuple`
+## The names of the named tuple are the names of components of the record
+## `obj`, further components of `obj` are ignored.
+function gap_to_julia_internal(
+    ::Type{TT},
+    obj::GapObj,
+    recursion_dict::JuliaCacheDict,
+    ::Val{recursive},
+) where {names, TT<:NamedTuple{names}, recursive}
+    return _gap_record_to_fields(TT, obj, map(_rnam_of_symbol, names), recursion_dict, Val(recursive))
+end
+
+# Return the object of type `TT` whose fields are the converted values of
+# the components of the GAP record `obj` with the numbers `rnams`,
+# in the order of the fields of `TT`.
+# This is used for named tuples and for the Julia types declared with
+# `GAP.@gaprecord`.
+@generated function _gap_record_to_fields(
+    ::Type{TT},
+    obj::GapObj,
+    rnams::NTuple{N,Int},
+    recursion_dict::JuliaCacheDict,
+    ::Val{recursive},
+) where {TT, N, recursive}
+
+    # If the field types are not prescribed then take `Any`,
+    # the constructor will then determine the type of the result.
+    types = TT isa DataType ? fieldtypes(TT) : ntuple(_ -> Any, N)
+    length(types) == N || return :(throw(ConversionError(obj, TT)))
+
+    entries = [:(gap_to_julia_internal($(types[i]), _record_component(obj, rnams[$i]), rec_dict, BoolVal(rec)))
+               for i in 1:N]
+    construct = TT <: NamedTuple ? :(TT($(Expr(:tuple, entries...)))) : :(TT($(entries...)))
+
+    return quote
+      !Wrappers.IsRecord(obj) && throw(ConversionError(obj, TT))
+
+      recursive && recursion_dict !== nothing && haskey(recursion_dict, (obj, TT)) && return recursion_dict[(obj, TT)]::TT
+
+      # Switch off recursion if none of the field types needs recursion.
+      rec = recursive && $(_any_needs_tracking_gap_to_julia(types))
+      rec_dict = recursion_info_j(TT, obj, rec, recursion_dict)
+
+      ret_val = $construct
+      handle_recursion((obj, TT), ret_val, rec, rec_dict)
+      return ret_val
+    end
+end
+
+function _record_component(obj::GapObj, rnam::Int)
+    Wrappers.ISB_REC(obj, rnam) ||
+      throw(ArgumentError("record $obj has no component $(_symbol_of_rnam(rnam))"))
+    return Wrappers.ELM_REC(obj, rnam)
+end
+
 ## `Dict` (replace by `Dict{Symbol,Any}`)
 function gap_to_julia_internal(
     ::Type{Dict},
@@ -424,21 +504,21 @@ julia> GAP.gap_to_julia(Matrix{Int}, val)
 
 The following `gap_to_julia` conversions are supported by GAP.jl.
 
-| GAP filter    | default Julia type       | other Julia types     |
-|---------------|--------------------------|-----------------------|
-| `IsInt`       | `BigInt`                 | `T <: Integer`        |
-| `IsFFE`       | `FFE`                    |                       |
-| `IsBool`      | `Bool`                   |                       |
-| `IsRat`       | `Rational{BigInt}`       | `Rational{T}`         |
-| `IsFloat`     | `Float64`                | `T <: AbstractFloat`  |
-| `IsChar`      | `Cuchar`                 | `Char`                |
-| `IsStringRep` | `String`                 | `Symbol`, `Vector{T}` |
-| `IsRangeRep`  | `StepRange{Int64,Int64}` | `Vector{T}`           |
-| `IsBListRep`  | `BitVector`              | `Vector{T}`           |
-| `IsList`      | `Vector{Any}`            | `Vector{T}`           |
-| `IsMatrixObj` | `Matrix{Any}`            | `Matrix{T}`           |
-| `IsVectorObj` | `Vector{Any}`            | `Vector{T}`           |
-| `IsRecord`    | `Dict{Symbol, Any}`      | `Dict{Symbol, T}`     |
+| GAP filter    | default Julia type       | other Julia types               |
+|---------------|--------------------------|---------------------------------|
+| `IsInt`       | `BigInt`                 | `T <: Integer`                  |
+| `IsFFE`       | `FFE`                    |                                 |
+| `IsBool`      | `Bool`                   |                                 |
+| `IsRat`       | `Rational{BigInt}`       | `Rational{T}`                   |
+| `IsFloat`     | `Float64`                | `T <: AbstractFloat`            |
+| `IsChar`      | `Cuchar`                 | `Char`                          |
+| `IsStringRep` | `String`                 | `Symbol`, `Vector{T}`           |
+| `IsRangeRep`  | `StepRange{Int64,Int64}` | `Vector{T}`                     |
+| `IsBListRep`  | `BitVector`              | `Vector{T}`                     |
+| `IsList`      | `Vector{Any}`            | `Vector{T}`                     |
+| `IsMatrixObj` | `Matrix{Any}`            | `Matrix{T}`                     |
+| `IsVectorObj` | `Vector{Any}`            | `Vector{T}`                     |
+| `IsRecord`    | `Dict{Symbol, Any}`      | `Dict{Symbol, T}`, `NamedTuple` |
 
 Other Julia packages may provide conversions for more GAP types.
 """
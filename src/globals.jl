@@ -55,6 +55,9 @@ function getproperty(::GlobalsType, name::Symbol)
 end
 
 function hasproperty(::GlobalsType, name::Symbol)
+    # First check that a variable with this name exists;
+    # this avoids creating a new GAP variable for an unknown name.
+    _has_global_name(name) || return false
     return _ValueGlobalVariable(name) !== C_NULL
 end
 
@@ -64,7 +67,95 @@ function setproperty!(::GlobalsType, name::Symbol, val::Any)
     _AssignGlobalVariable(name, tmp)
 end
 
-propertynames(::GlobalsType, private::Bool=false) = Vector{Symbol}(Globals.NamesGVars())
+## Index of the names of GAP variables.
+##
+## GAP never deletes a global variable, and numbers the variables in the
+## order in which they are created. Thus the index is brought up to date
+## by fetching only the names of the variables beyond the last known
+## number from the kernel, and merging them into the sorted names.
+mutable struct GlobalNamesIndex
+    count::Int                # number of GAP variables in the index
+    symbols::Vector{Symbol}   # names in the order of creation
+    known::Set{Symbol}        # the same names, for membership tests
+    sorted::Vector{String}    # the same names, sorted, for prefix search
+end
+
+const _GLOBAL_NAMES = GlobalNamesIndex(0, Symbol[], Set{Symbol}(), String[])
+
+function _update_global_names!()
+    idx = _GLOBAL_NAMES
+    names = @ccall JuliaInterface_path.gap_gvar_names_since(idx.count::Culong)::GapObj
+    m = length(names)
+    m == 0 && return idx
+    new = Vector{String}(undef, m)
+    for i in 1:m
+        str = String(names[i]::GapObj)
+        sym = Symbol(str)
+        push!(idx.symbols, sym)
+        push!(idx.known, sym)
+        new[i] = str
+    end
+    idx.sorted = _merge_sorted(idx.sorted, sort!(new))
+    idx.count += m
+    return idx
+end
+
+# Return the sorted vector of the entries of the sorted vectors `a` and `b`.
+function _merge_sorted(a::Vector{String}, b::Vector{String})
+    isempty(b) && return a
+    res = Vector{String}(undef, length(a) + length(b))
+    i = j = 1
+    for k in eachindex(res)
+        if j > length(b) || (i <= length(a) && a[i] <= b[j])
+            res[k] = a[i]
+            i += 1
+        else
+            res[k] = b[j]
+            j += 1
+        end
+    end
+    return res
+end
+
+# Return whether a GAP variable with name `name` exists (not necessarily bound).
+# This does not create a GAP variable.
+function _has_global_name(name::Symbol)
+    name in _GLOBAL_NAMES.known && return true
+    return name in _update_global_names!().known
+end
+
+"""
+    global_names_with_prefix(prefix::AbstractString)
+
+Return the sorted vector of the names of GAP variables that start with `prefix`.
+
+The names are taken from an index that is updated when new GAP variables
+have been created; it is also used by `propertynames(GAP.Globals)`,
+and thus for tab completion on `GAP.Globals` in the Julia REPL.
+
+# Examples
+```jldoctest
+julia> l = GAP.global_names_with_prefix("Dihedral");
+
+julia> "DihedralGroup" in l
+true
+
+julia> all(startswith("Dihedral"), l) && issorted(l)
+true
+```
+"""
+function global_names_with_prefix(prefix::AbstractString)
+    sorted = _update_global_names!().sorted
+    res = String[]
+    i = searchsortedfirst(sorted, prefix)
+    while i <= length(sorted) && startswith(sorted[i], prefix)
+        push!(res, sorted[i])
+        i += 1
+    end
+    return res
+end
+
+propertynames(::GlobalsType, private::Bool=false) = copy(_update_global_names!().symbols)
 
 function replace_global!(name::Symbol, val::Any)
     n = GapObj(name)
@@ -73,4 +164,42 @@ function replace_global!(name::Symbol, val::Any)
     Wrappers.MakeReadOnlyGlobal(n)
 end
 
-propertynames(r::GapObj, private::Bool=false) = Wrappers.IsRecord(r) ? Vector{Symbol}(Wrappers.RecNames(r)) : Vector{Symbol}()
+# The numbers of record components are valid only in the GAP session in
+# which they were computed; `__init__` sets this to a new random value,
+# and empties the caches below.
+const _session_id = Ref{UInt}(0)
+
+# cache of the names of record components, indexed by their numbers
+const _RNAM_SYMBOLS = Dict{Int,Symbol}()
+
+_symbol_of_rnam(rnam::Int) = get!(() -> Symbol(String(Wrappers.NameRNam(rnam))), _RNAM_SYMBOLS, rnam)
+
+# cache of the numbers of record components, indexed by their names
+const _SYMBOL_RNAMS = Dict{Symbol,Int}()
+
+_rnam_of_symbol(name::Symbol) = get!(() -> RNamObj(name), _SYMBOL_RNAMS, name)
+
+# Return the numbers of the record components `names`;
+# they are stored in `ref` together with the current session id,
+# and are recomputed if `ref` was filled in another session,
+# for example during precompilation.
+# This is used by the code generated by `GAP.@gaprecord`.
+function _record_rnams(ref::Base.RefValue{Tuple{UInt,NTuple{N,Int}}}, names::NTuple{N,Symbol}) where N
+    session, rnams = ref[]
+    if session != _session_id[]
+        rnams = map(RNamObj, names)
+        ref[] = (_session_id[], rnams)
+    end
+    return rnams
+end
+
+function propertynames(r::GapObj, private::Bool=false)
+    Wrappers.IsRecord(r) || return Vector{Symbol}()
+    rnams = Int[]
+    n = @ccall JuliaInterface_path.gap_rnams_prec(r::GapObj, rnams::Ptr{Int}, 0::Culong)::Int
+    # for records which are not plain records, ask GAP
+    n < 0 && return Vector{Symbol}(Wrappers.RecNames(r))
+    resize!(rnams, n)
+    @ccall JuliaInterface_path.gap_rnams_prec(r::GapObj, rnams::Ptr{Int}, n::Culong)::Int
+    return Symbol[_symbol_of_rnam(rnam) for rnam in rnams]
+end
@@ -0,0 +1,235 @@
+#############################################################################
+##
+##  This file is part of GAP.jl, a bidirectional interface between Julia and
+##  the GAP computer algebra system.
+##
+##  Copyright of GAP.jl and its parts belongs to its developers.
+##  Please refer to its README.md file for details.
+##
+##  SPDX-License-Identifier: LGPL-3.0-or-later
+##
+
+## Batched conversion of vectors and matrices of big integers and rationals.
+##
+## For a GAP list of integers, JuliaInterface (see `convert.c` there) first
+## reports the numbers of limbs of all entries, then the Julia side provides
+## the storage for all results, and then the limbs are copied in one call.
+## In the other direction, the limbs of all entries are handed over at once.
+
+# which integers belong to the entries of a GAP list
+const _PART_INT = 0   # the entries themselves, which must be integers
+const _PART_NUM = 1   # the numerators of the entries
+const _PART_DEN = 2   # the denominators of the entries
+
+const _BITS_PER_LIMB = sizeof(UInt) * 8
+
+# Store in `sizes` the signed numbers of limbs of the first `length(sizes)`
+# entries of the GAP list `list`, resp. of their numerators or denominators.
+# Return `false` if not all these entries are integers resp. rationals.
+function int_list_sizes!(sizes::Vector{Int}, list::GapObj, part::Int)
+    pos = GC.@preserve sizes @ccall JuliaInterface_path.gap_int_list_sizes(list::GapObj, length(sizes)::Culong, part::Int, pointer(sizes)::Ptr{Int})::Int
+    return pos == 0
+end
+
+# Copy the limbs of the absolute values of the first `length(limbs)` entries
+# of the GAP list `list`, resp. of their numerators or denominators,
+# to the buffers in `limbs`, which must be large enough.
+function int_list_limbs!(limbs::Vector{Ptr{UInt}}, list::GapObj, part::Int)
+    GC.@preserve limbs @ccall JuliaInterface_path.gap_int_list_limbs(list::GapObj, length(limbs)::Culong, part::Int, pointer(limbs)::Ptr{Ptr{UInt}})::Cvoid
+    return limbs
+end
+
+# Return a GAP list with the entries of the GAP list or vector object `obj`.
+function _entries_list(obj::GapObj, T::Type)
+    Wrappers.IsList(obj) && return obj
+    Wrappers.IsVectorObj(obj) && return Wrappers.Unpack(obj)
+    throw(ConversionError(obj, T))
+end
+
+# Return a GAP list with the rows of the GAP list of lists or matrix object
+# `obj`.
+function _rows_list(obj::GapObj, T::Type)
+    Wrappers.IsList(obj) && return obj
+    Wrappers.IsMatrixObj(obj) && return Wrappers.Unpack(obj)
+    throw(ConversionError(obj, T))
+end
+
+# Set the entries of `dest` at the positions `inds` to new `BigInt`s with
+# the values of the entries of the GAP list `list`, resp. of their
+# numerators or denominators.
+# The previous entries of `dest` are not changed, since they may be shared.
+function _set_bigints!(dest::Array{BigInt}, inds::AbstractRange{Int}, list::GapObj, part::Int, sizes::Vector{Int}, limbs::Vector{Ptr{UInt}})
+    int_list_sizes!(sizes, list, part) || return false
+    for (k, i) in enumerate(inds)
+        x = dest[i] = Base.GMP.MPZ.realloc2(abs(sizes[k]) * _BITS_PER_LIMB)
+        limbs[k] = x.d
+    end
+    GC.@preserve dest int_list_limbs!(limbs, list, part)
+    for (k, i) in enumerate(inds)
+        dest[i].size = sizes[k]
+    end
+    return true
+end
+
+function _set_entries!(nums::Array{BigInt}, dens::Union{Nothing, Array{BigInt}}, inds::AbstractRange{Int}, list::GapObj, sizes::Vector{Int}, limbs::Vector{Ptr{UInt}})
+    dens === nothing && return _set_bigints!(nums, inds, list, _PART_INT, sizes, limbs)
+    return _set_bigints!(nums, inds, list, _PART_NUM, sizes, limbs) &&
+           _set_bigints!(dens, inds, list, _PART_DEN, sizes, limbs)
+end
+
+# Set the entries of the vector `nums` (and `dens`) from the GAP list `list`.
+function _convert_entries!(nums::Vector{BigInt}, dens::Union{Nothing, Vector{BigInt}}, list::GapObj, src::GapObj, T::Type)
+    len = length(nums)
+    sizes = Vector{Int}(undef, len)
+    limbs = Vector{Ptr{UInt}}(undef, len)
+    _set_entries!(nums, dens, 1:len, list, sizes, limbs) || throw(ConversionError(src, T))
+end
+
+# Set the entries of the matrix `nums` (and `dens`) from the GAP list of
+# rows `rows`.
+function _convert_entries!(nums::Matrix{BigInt}, dens::Union{Nothing, Matrix{BigInt}}, rows::GapObj, src::GapObj, T::Type)
+    nrows, ncols = size(nums)
+    length(rows) == nrows || throw(DimensionMismatch("expected $nrows rows, got $(length(rows))"))
+    sizes = Vector{Int}(undef, ncols)
+    limbs = Vector{Ptr{UInt}}(undef, ncols)
+    for i in 1:nrows
+        row = rows[i]
+        row isa GapObj && Wrappers.IsList(row) && length(row) == ncols || throw(ConversionError(src, T))
+        # the linear indices of the `i`-th row of `nums`
+        inds = range(i; step = nrows, length = ncols)
+        _set_entries!(nums, dens, inds, row, sizes, limbs) || throw(ConversionError(src, T))
+    end
+end
+
+"""
+    GAP.convert!(dest::Vector{BigInt}, src::GapObj)
+    GAP.convert!(dest::Matrix{BigInt}, src::GapObj)
+    GAP.convert!(dest::Vector{Rational{BigInt}}, src::GapObj)
+    GAP.convert!(dest::Matrix{Rational{BigInt}}, src::GapObj)
+
+Set the entries of `dest` to the integers resp. rationals in the
+GAP list or vector object resp. GAP matrix `src`, and return `dest`.
+A vector `dest` is resized to the length of `src`,
+a matrix `dest` must have the same dimensions as `src`.
+
+The limbs of all entries of `src` (or of a row of `src`) are copied at once,
+into new `BigInt`s that are stored in `dest`.
+The previous entries of `dest` are not changed, thus they may be shared
+with other objects; only the storage of the array `dest` is reused.
+
+The same batched conversion is used by [`gap_to_julia`](@ref) and
+the constructors for vectors and matrices of `BigInt`s and
+`Rational{BigInt}`s, and by [`GapObj`](@ref) for such vectors and matrices.
+
+# Examples
+```jldoctest
+julia> v = BigInt[];
+
+julia> GAP.convert!(v, GAP.evalstr("[ 2^100, -1, 0 ]"));
+
+julia> v == [big(2)^100, -1, 0]
+true
+
+julia> m = Matrix{Rational{BigInt}}(undef, 1, 2);
+
+julia> GAP.convert!(m, GAP.evalstr("[ [ 1/2^70, 3 ] ]"))
+1×2 Matrix{Rational{BigInt}}:
+ 1//1180591620717411303424  3//1
+```
+"""
+function convert!(dest::Vector{BigInt}, src::GapObj)
+    list = _entries_list(src, Vector{BigInt})
+    resize!(dest, length(list))
+    _convert_entries!(dest, nothing, list, src, Vector{BigInt})
+    return dest
+end
+
+function convert!(dest::Matrix{BigInt}, src::GapObj)
+    _convert_entries!(dest, nothing, _rows_list(src, Matrix{BigInt}), src, Matrix{BigInt})
+    return dest
+end
+
+function convert!(dest::Vector{Rational{BigInt}}, src::GapObj)
+    list = _entries_list(src, Vector{Rational{BigInt}})
+    resize!(dest, length(list))
+    return _convert_rationals!(dest, list, src)
+end
+
+convert!(dest::Matrix{Rational{BigInt}}, src::GapObj) =
+    _convert_rationals!(dest, _rows_list(src, Matrix{Rational{BigInt}}), src)
+
+function _convert_rationals!(dest::Array{Rational{BigInt}}, list::GapObj, src::GapObj)
+    nums = similar(dest, BigInt)
+    dens = similar(dest, BigInt)
+    _convert_entries!(nums, dens, list, src, typeof(dest))
+    for i in eachindex(dest)
+        dest[i] = Base.unsafe_rational(nums[i], dens[i])
+    end
+    return dest
+end
+
+function _gap_to_julia_batched(::Type{TT}, obj::GapObj, recursion_dict::JuliaCacheDict, recursive::Bool) where TT
+    recursive && recursion_dict !== nothing && haskey(recursion_dict, (obj, TT)) && return recursion_dict[(obj, TT)]::TT
+
+    if TT <: Vector
+        ret_val = convert!(TT(), obj)
+    else
+        rows = _rows_list(obj, TT)
+        nrows = length(rows)
+        ncols = nrows == 0 ? 0 : length(rows[1])
+        ret_val = convert!(TT(undef, nrows, ncols), obj)
+    end
+
+    # the entries need no tracking
+    handle_recursion((obj, TT), ret_val, false, recursion_dict)
+    return ret_val::TT
+end
+
+gap_to_julia_internal(::Type{Vector{BigInt}}, obj::GapObj, recursion_dict::JuliaCacheDict, ::Val{recursive}) where recursive =
+    _gap_to_julia_batched(Vector{BigInt}, obj, recursion_dict, recursive)
+gap_to_julia_internal(::Type{Matrix{BigInt}}, obj::GapObj, recursion_dict::JuliaCacheDict, ::Val{recursive}) where recursive =
+    _gap_to_julia_batched(Matrix{BigInt}, obj, recursion_dict, recursive)
+gap_to_julia_internal(::Type{Vector{Rational{BigInt}}}, obj::GapObj, recursion_dict::JuliaCacheDict, ::Val{recursive}) where recursive =
+    _gap_to_julia_batched(Vector{Rational{BigInt}}, obj, recursion_dict, recursive)
+gap_to_julia_internal(::Type{Matrix{Rational{BigInt}}}, obj::GapObj, recursion_dict::JuliaCacheDict, ::Val{recursive}) where recursive =
+    _gap_to_julia_batched(Matrix{Rational{BigInt}}, obj, recursion_dict, recursive)
+
+# Return a GAP list with the integers given by the limbs `num_limbs` and
+# the signed sizes `num_sizes`, or with the reduced fractions whose positive
+# denominators are given by `den_limbs` and `den_sizes`.
+function rat_list_from_limbs(num_limbs::Vector{Ptr{UInt}}, num_sizes::Vector{Int}, den_limbs::Vector{Ptr{UInt}}, den_sizes::Vector{Int})
+    return @ccall JuliaInterface_path.gap_rat_list_from_limbs(length(num_limbs)::Culong, num_limbs::Ptr{Ptr{UInt}}, num_sizes::Ptr{Int}, den_limbs::Ptr{Ptr{UInt}}, den_sizes::Ptr{Int})::GapObj
+end
+
+function rat_list_from_limbs(num_limbs::Vector{Ptr{UInt}}, num_sizes::Vector{Int}, ::Nothing, ::Nothing)
+    return @ccall JuliaInterface_path.gap_rat_list_from_limbs(length(num_limbs)::Culong, num_limbs::Ptr{Ptr{UInt}}, num_sizes::Ptr{Int}, C_NULL::Ptr{Ptr{UInt}}, C_NULL::Ptr{Int})::GapObj
+end
+
+_limbs(v::Vector{BigInt}) = Ptr{UInt}[x.d for x in v]
+_sizes(v::Vector{BigInt}) = Int[x.size for x in v]
+
+## Vectors of `BigInt`s and `Rational{BigInt}`s
+## (matrices are converted row by row via these methods)
+function GapObj_internal(obj::Vector{BigInt}, recursion_dict::GapCacheDict, ::Val{recursive}) where recursive
+    recursive && recursion_dict !== nothing && haskey(recursion_dict, obj) && return recursion_dict[obj]
+    ret_val = GC.@preserve obj rat_list_from_limbs(_limbs(obj), _sizes(obj), nothing, nothing)
+    recursion_info_g(BigInt, obj, ret_val, BoolVal(recursive), recursion_dict)
+    return ret_val
+end
+
+function GapObj_internal(obj::Vector{Rational{BigInt}}, recursion_dict::GapCacheDict, ::Val{recursive}) where recursive
+    recursive && recursion_dict !== nothing && haskey(recursion_dict, obj) && return recursion_dict[obj]
+    if any(x -> iszero(denominator(x)), obj)
+        # infinite values are not supported by the batched conversion
+        ret_val = NewPlist(length(obj))
+        for i in 1:length(obj)
+            ret_val[i] = GapObj(obj[i])
+        end
+    else
+        nums = map(numerator, obj)
+        dens = map(denominator, obj)
+        ret_val = GC.@preserve nums dens rat_list_from_limbs(_limbs(nums), _sizes(nums), _limbs(dens), _sizes(dens))
+    end
+    recursion_info_g(BigInt, obj, ret_val, BoolVal(recursive), recursion_dict)
+    return ret_val
+end
@@ -0,0 +1,166 @@
+#############################################################################
+##
+##  This file is part of GAP.jl, a bidirectional interface between Julia and
+##  the GAP computer algebra system.
+##
+##  Copyright of GAP.jl and its parts belongs to its developers.
+##  Please refer to its README.md file for details.
+##
+##  SPDX-License-Identifier: LGPL-3.0-or-later
+##
+
+## Time limits and cancellation for GAP computations.
+##
+## While the GAP kernel is busy, the Julia scheduler does not run, hence
+## a Julia `Timer` cannot stop a GAP computation. Instead, JuliaInterface
+## starts a "watchdog" thread which sets GAP's interrupt flag (as GAP's
+## own SIGINT handler does) when the time limit is reached or when the
+## computation gets cancelled. GAP then raises a "user interrupt" error at
+## the next statement it executes, which unwinds the GAP stack and gets
+## turned into a Julia exception in the usual way.
+
+"""
+    GAP.InterruptedError
+
+Exception thrown by [`GAP.with_timeout`](@ref) and
+[`GAP.with_cancellation`](@ref) if the GAP computation was interrupted
+because the time limit was reached or because it was cancelled.
+"""
+struct InterruptedError <: Exception
+    msg::String
+end
+
+Base.showerror(io::IO, e::InterruptedError) = print(io, "GAP computation interrupted: ", e.msg)
+
+_start_watchdog(seconds::Float64) =
+    @ccall JuliaInterface_path.gap_start_watchdog(seconds::Cdouble)::Ptr{Cvoid}
+
+_trigger_watchdog(wd::Ptr{Cvoid}) =
+    @ccall JuliaInterface_path.gap_trigger_watchdog(wd::Ptr{Cvoid})::Cvoid
+
+# Stop the watchdog `wd` and return whether it has interrupted GAP.
+function _stop_watchdog(wd::Ptr{Cvoid})
+    fired = (@ccall JuliaInterface_path.gap_stop_watchdog(wd::Ptr{Cvoid})::Cint) != 0
+    if fired
+        # If the watchdog fired after the GAP computation had finished then
+        # the interrupt is still pending; discard it, such that subsequent
+        # GAP computations are not affected.
+        @ccall libgap.ClearError()::Cvoid
+    end
+    return fired
+end
+
+# Return `f()`; afterwards call `stop()`, which must stop the watchdog and
+# return whether it has interrupted GAP. If `f` throws because of such an
+# interrupt, throw an `InterruptedError` with message `msg` instead.
+function _run_with_watchdog(f, stop, msg::String)
+    result = try
+        f()
+    catch
+        stop() && throw(InterruptedError(msg))
+        rethrow()
+    end
+    stop()
+    return result
+end
+
+"""
+    with_timeout(f, seconds::Real)
+
+Return `f()`, but interrupt the GAP computations performed by `f`
+if they take longer than `seconds` seconds,
+and throw a [`GAP.InterruptedError`](@ref) in this case.
+
+After an interrupt, GAP is in a clean state and can be used as before.
+
+Note that GAP checks for interrupts only between the statements of
+GAP functions, so calls of a single long running kernel function
+(for example the multiplication of huge integers)
+are not interrupted before they return.
+
+# Examples
+```jldoctest
+julia> GAP.with_timeout(() -> GAP.Globals.Factorial(10), 10)
+3628800
+
+julia> f = GAP.evalstr("function() local i; i:= 0; while true do i:= i+1; od; end");
+
+julia> GAP.with_timeout(f, 0.1)
+ERROR: GAP computation interrupted: time limit of 0.1 seconds exceeded
+[...]
+```
+"""
+function with_timeout(f, seconds::Real)
+    seconds > 0 || throw(ArgumentError("<seconds> must be positive"))
+    wd = _start_watchdog(Float64(seconds))
+    wd == C_NULL && error("failed to start watchdog thread")
+    return _run_with_watchdog(f, () -> _stop_watchdog(wd),
+                              "time limit of $seconds seconds exceeded")
+end
+
+"""
+    GAP.CancellationToken()
+
+Return a token that can be used to cancel GAP computations started via
+[`GAP.with_cancellation`](@ref), by calling [`GAP.cancel!`](@ref) for it
+from another Julia thread.
+
+A token that has been cancelled stays cancelled,
+subsequent calls of `GAP.with_cancellation` with it throw immediately.
+"""
+mutable struct CancellationToken
+    const lock::ReentrantLock
+    watchdog::Ptr{Cvoid}
+    @atomic cancelled::Bool
+
+    CancellationToken() = new(ReentrantLock(), C_NULL, false)
+end
+
+"""
+    cancel!(token::GAP.CancellationToken)
+
+Cancel the GAP computation that is currently running under `token`
+(see [`GAP.with_cancellation`](@ref)), and mark `token` as cancelled.
+"""
+function cancel!(token::CancellationToken)
+    @lock token.lock begin
+        @atomic token.cancelled = true
+        token.watchdog == C_NULL || _trigger_watchdog(token.watchdog)
+    end
+    return nothing
+end
+
+"""
+    is_cancelled(token::GAP.CancellationToken)
+
+Return whether [`GAP.cancel!`](@ref) has been called for `token`.
+"""
+is_cancelled(token::CancellationToken) = @atomic token.cancelled
+
+"""
+    with_cancellation(f, token::GAP.CancellationToken)
+
+Return `f()`, but interrupt the GAP computations performed by `f`
+as soon as [`GAP.cancel!`](@ref) gets called for `token`,
+and throw a [`GAP.InterruptedError`](@ref) in this case.
+
+Since the GAP kernel blocks the Julia thread on which it runs,
+`GAP.cancel!` must be called from a task on another Julia thread.
+"""
+function with_cancellation(f, token::CancellationToken)
+    wd = @lock token.lock begin
+        is_cancelled(token) && throw(InterruptedError("cancelled"))
+        token.watchdog == C_NULL ||
+            throw(ArgumentError("<token> is already in use"))
+        w = _start_watchdog(0.0)
+        w == C_NULL && error("failed to start watchdog thread")
+        token.watchdog = w
+    end
+    # detach the watchdog from the token before it gets freed,
+    # such that a concurrent `cancel!` does not access it anymore
+    stop() = @lock token.lock begin
+        token.watchdog = C_NULL
+        _stop_watchdog(wd)
+    end
+    return _run_with_watchdog(f, stop, "cancelled")
+end
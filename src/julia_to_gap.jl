@@ -72,6 +72,7 @@ The following `GapObj` conversions are supported by GAP.jl.
 | `Tuple{T}`                           | `IsList`     |
 | `Matrix{T}`                          | `IsList`     |
 | `Dict{String, T}`, `Dict{Symbol, T}` | `IsRecord`   |
+| `NamedTuple`                         | `IsRecord`   |
 | `UnitRange{T}`, `StepRange{T, S}`    | `IsRange`    |
 | `Function`                           | `IsFunction` |
 
@@ -204,6 +205,18 @@ function GapObj_internal(
 end
 
 ## Sets
+## If the elements are integers, rationals or strings then their
+## GAP counterparts are ordered in GAP like the elements in Julia,
+## thus we can sort the elements in Julia and mark the GAP list as
+## strictly sorted; otherwise GAP has to sort the list.
+## In non-recursive conversions, only `Int` elements get converted.
+const _SortedLikeInGAP = Union{Base.BitInteger, BigInt,
+                               Rational{<:Union{Base.BitInteger, BigInt}},
+                               String, Symbol}
+
+_is_sorted_like_in_gap(::Type{T}, recursive::Bool) where T =
+    recursive ? T <: _SortedLikeInGAP : T <: Int
+
 function GapObj_internal(
     obj::Set{T},
     recursion_dict::GapCacheDict,
@@ -212,13 +225,20 @@ function GapObj_internal(
 
     recursive && recursion_dict !== nothing && haskey(recursion_dict, obj) && return recursion_dict[obj]
 
+    if _is_sorted_like_in_gap(T, recursive)
+        ret_val = GapObj_internal(sort!(collect(obj)), nothing, Val(true))
+        set_ssorted_plist!(ret_val)
+        recursive && recursion_dict !== nothing && (recursion_dict[obj] = ret_val)
+        return ret_val
+    end
+
     ret_val = NewPlist(length(obj))
 
     recursion_dict = recursion_info_g(T, obj, ret_val, BoolVal(recursive), recursion_dict)
 
-    for x in obj
+    for (i, x) in enumerate(obj)
         res = recursive ? GapObj_internal(x, recursion_dict, Val(true)) : x
-        Wrappers.Add(ret_val, res)
+        ret_val[i] = res
     end
     Wrappers.Sort(ret_val)
     @assert Wrappers.IsSet(ret_val)
@@ -286,6 +306,48 @@ function GapObj_internal(
     return ret_val
 end
 
+## Named tuples
+function GapObj_internal(
+    obj::NamedTuple{names},
+    recursion_dict::GapCacheDict,
+    ::Val{recursive},
+) where {names, recursive}
+    return _fields_to_gap_record(obj, map(_rnam_of_symbol, names), recursion_dict, Val(recursive))
+end
+
+# Return the GAP record whose components with the numbers `rnams` are
+# the values of the fields of `obj`, in the order of the fields.
+# This is used for named tuples and for the Julia types declared with
+# `GAP.@gaprecord`.
+@generated function _fields_to_gap_record(
+    obj::T,
+    rnams::NTuple{N,Int},
+    recursion_dict::GapCacheDict,
+    ::Val{recursive},
+) where {T, N, recursive}
+
+    fieldcount(T) == N || return :(throw(ConversionError(obj, GapObj)))
+
+    assignments = [:(Wrappers.ASS_REC(ret_val, rnams[$i],
+                                      recursive ? GapObj_internal(getfield(obj, $i), recursion_dict, Val(true)) : getfield(obj, $i)))
+                   for i in 1:N]
+
+    # the types of the values that may need tracking
+    S = N == 0 ? Any : Union{fieldtypes(T)...}
+
+    return quote
+      recursive && recursion_dict !== nothing && haskey(recursion_dict, obj) && return recursion_dict[obj]
+
+      ret_val = NewPrecord($N)
+
+      recursion_dict = recursion_info_g($S, obj, ret_val, BoolVal(recursive), recursion_dict)
+
+      $(assignments...)
+
+      return ret_val
+    end
+end
+
 ## GAP objects:
 ## We have to do something only if recursive conversion is required,
 ## and if `obj` contains Julia subobjects;
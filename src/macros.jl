@@ -498,3 +498,82 @@ macro install(ex)
         :(Base.@__doc__ $ex),
         ))
 end
+
+
+"""
+    @gaprecord
+
+When applied to the definition of a Julia struct type `T`, say,
+this macro defines the type and installs conversion methods
+between objects of type `T` and [GAP records](GAP_ref(ref:Records)),
+such that the fields of `T` correspond to the record components
+of the same names.
+
+- [`GapObj`](@ref) returns for an object of type `T` a GAP record
+  whose components are the fields of the object;
+  the field values are converted recursively if `recursive` is `true`,
+  as for dictionaries,
+- [`gap_to_julia`](@ref) with first argument `T` returns
+  for a GAP record the object of type `T` that is constructed
+  from the converted values of the record components;
+  these values are converted to the types of the fields,
+  further components of the record are ignored.
+
+The numbers of the record components are computed only once per session,
+and the conversion code is specialized for the field types,
+thus the conversions are cheaper than those via `Dict{Symbol,Any}`.
+
+If `T` is a parametric type then the type parameters should be given
+in conversions to `T`, unless the constructor of `T` can derive them
+from the converted values.
+
+# Examples
+```jldoctest
+julia> GAP.@gaprecord struct Point
+         x::Int
+         y::Rational{Int}
+       end
+
+julia> GapObj(Point(1, 2//3); recursive = true)
+GAP: rec( x := 1, y := 2/3 )
+
+julia> GAP.gap_to_julia(Point, @gap(rec(x := 3, y := 4, z := 5)))
+Point(3, 4//1)
+
+```
+"""
+macro gaprecord(ex)
+    errmsg = "GAP.@gaprecord must be applied to a struct definition"
+
+    def_dict = try
+        MacroTools.splitstructdef(ex)
+    catch
+        error(errmsg)
+    end
+
+    name = def_dict[:name]
+    names = Tuple(Symbol[first(x) for x in def_dict[:fields]])
+    N = length(names)
+    rnams = gensym(:rnams)
+
+    return esc(MacroTools.@qq begin
+        Base.@__doc__ $ex
+        const $rnams = Ref{Tuple{UInt,NTuple{$N,Int}}}((UInt(0), $(ntuple(_ -> 0, N))))
+        function GAP.gap_to_julia_internal(
+            ::Type{TT},
+            obj::GAP.GapObj,
+            recursion_dict::GAP.JuliaCacheDict,
+            ::Val{recursive},
+        ) where {TT<:$name, recursive}
+            return GAP._gap_record_to_fields(TT, obj, GAP._record_rnams($rnams, $(QuoteNode(names))), recursion_dict, Val(recursive))
+        end
+        function GAP.GapObj_internal(
+            obj::$name,
+            recursion_dict::GAP.GapCacheDict,
+            ::Val{recursive},
+        ) where recursive
+            return GAP._fields_to_gap_record(obj, GAP._record_rnams($rnams, $(QuoteNode(names))), recursion_dict, Val(recursive))
+        end
+        nothing
+    end)
+end
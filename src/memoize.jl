@@ -0,0 +1,199 @@
+#############################################################################
+##
+##  This file is part of GAP.jl, a bidirectional interface between Julia and
+##  the GAP computer algebra system.
+##
+##  Copyright of GAP.jl and its parts belongs to its developers.
+##  Please refer to its README.md file for details.
+##
+##  SPDX-License-Identifier: LGPL-3.0-or-later
+##
+
+## Persistent memoization of results of GAP function calls.
+##
+## Arguments and results are serialized with the pickling functions of
+## the GAP package IO. The key of a call is the SHA-256 hash of the name of
+## the function, the pickled arguments, and the versions of GAP and all
+## loaded GAP packages; the pickled result is stored in a file named after
+## this key, in a scratchspace of GAP.jl.
+## Files are written under a temporary name and then renamed, such that
+## several processes can safely fill the same cache concurrently.
+
+import SHA
+
+# bump this when the format of keys or cache files changes
+const MEMOIZE_FORMAT_VERSION = 1
+
+# the directory of the cache; if this is empty then a scratchspace of GAP.jl
+# is used, the tests set it to a temporary directory
+const _memoize_dir = Ref{String}("")
+
+function memoize_dir()
+    isempty(_memoize_dir[]) || return _memoize_dir[]
+    return get_scratch!(GAP, "memoize_v$(MEMOIZE_FORMAT_VERSION)")
+end
+
+# Return the pickled `obj` as a GAP string, or `nothing` if `obj` cannot be
+# pickled.
+function _pickle(obj)
+    s = MakeString("")
+    f = Globals.IO_WrapFD(-1, false, s)::GapObj
+    status = Globals.IO_Pickle(f, obj)
+    Globals.IO_Close(f)
+    status === Globals.IO_OK || return nothing
+    return Wrappers.IsStringRep(s) ? s : Wrappers.CopyToStringRep(s)
+end
+
+# Return the unpickled object from the GAP string `s`, or `nothing` if `s`
+# does not contain a valid pickle.
+function _unpickle(s::GapObj)
+    f = Globals.IO_WrapFD(-1, s, false)::GapObj
+    res = Globals.IO_Unpickle(f)
+    Globals.IO_Close(f)
+    res === Globals.IO_Error && return nothing
+    return res
+end
+
+# Describe the versions of GAP and of all loaded GAP packages,
+# these become part of the key of each cached call.
+function _versions_fingerprint(io::IO)
+    print(io, "GAP=", GAP_VERSION)
+    loaded = Globals.GAPInfo.PackagesLoaded::GapObj
+    for name in sort!(Vector{String}(Wrappers.RecNames(loaded)))
+        print(io, ';', name, '=', String(getproperty(loaded, Symbol(name))[2]))
+    end
+end
+
+# Return the name of `func` if it is the value of the global GAP variable
+# with this name, and `nothing` otherwise. Only such functions can be
+# identified by their names, different anonymous functions for example
+# have the same name.
+function _global_function_name(func::GapObj)
+    name = Globals.NameFunction(func)::GapObj
+    Globals.IsBoundGlobal(name) || return nothing
+    Globals.ValueGlobal(name) === func || return nothing
+    return String(name)
+end
+
+# Return the hex string key for calling `func` with the arguments `args`,
+# or `nothing` if `func` is not a global function or some argument cannot
+# be pickled.
+function _memoize_key(func::GapObj, args)
+    name = _global_function_name(func)
+    name === nothing && return nothing
+    io = IOBuffer()
+    print(io, "v", MEMOIZE_FORMAT_VERSION, ';')
+    _versions_fingerprint(io)
+    print(io, ";func=", name)
+    for x in args
+        p = _pickle(x)
+        p === nothing && return nothing
+        GC.@preserve p begin
+            ptr, len = UNSAFE_CSTR_STRING(p)
+            print(io, ';', len, ':')
+            unsafe_write(io, ptr, len)
+        end
+    end
+    return bytes2hex(SHA.sha256(take!(io)))
+end
+
+function _memoize_path(key::String)
+    return joinpath(memoize_dir(), key[1:2], key[3:end])
+end
+
+function _memoize_read(path::String)
+    isfile(path) || return nothing
+    data = read(path)
+    isempty(data) && return nothing
+    s = GC.@preserve data @ccall libgap.GAP_MakeStringWithLen(pointer(data)::Ptr{UInt8}, length(data)::Culong)::GapObj
+    return _unpickle(s)
+end
+
+function _memoize_write(path::String, s::GapObj)
+    dir = dirname(path)
+    mkpath(dir)
+    # write into a temporary file in the same directory, then rename it;
+    # since renaming is atomic, concurrent readers and writers never see
+    # a partially written file
+    tmp, io = mktemp(dir; cleanup=false)
+    try
+        GC.@preserve s unsafe_write(io, UNSAFE_CSTR_STRING(s)...)
+        close(io)
+        mv(tmp, path; force=true)
+    catch
+        close(io)
+        rm(tmp; force=true)
+        rethrow()
+    end
+    return nothing
+end
+
+"""
+    cached_call(func::GapObj, args...)
+
+Return `func(args...)`, and store the result on disk such that subsequent
+calls with equal arguments, also in other Julia sessions, return the stored
+value instead of computing it again.
+
+The stored values are keyed by the name of `func`, the arguments `args`,
+and the versions of GAP and all loaded GAP packages
+(see [`GAP.versioninfo`](@ref)),
+thus loading other GAP packages or updating them invalidates the cache.
+It is assumed that `func` is a function without side effects whose result
+depends only on the arguments.
+
+Arguments and results are serialized with the pickling functionality of
+the GAP package IO.
+If an argument or the result cannot be pickled then the result is
+computed but not stored.
+The same holds if `func` is not the value of the global GAP variable whose
+name is the name of `func`, for example if `func` is an anonymous function.
+
+Calls with equal arguments from several Julia processes can safely be
+executed concurrently.
+
+# Examples
+```jldoctest
+julia> GAP.cached_call(GAP.Globals.IdGroup, GAP.Globals.SymmetricGroup(4))
+GAP: [ 24, 12 ]
+
+julia> GAP.@memoize GAP.Globals.IdGroup(GAP.Globals.SymmetricGroup(4))
+GAP: [ 24, 12 ]
+```
+"""
+function cached_call(func::GapObj, args...)
+    Packages.load("io") || error("the GAP package IO cannot be loaded")
+    key = _memoize_key(func, args)
+    key === nothing && return func(args...)
+    path = _memoize_path(key)
+
+    res = _memoize_read(path)
+    res === nothing || return res
+
+    res = func(args...)
+    res === nothing && return res
+    s = _pickle(res)
+    s === nothing || _memoize_write(path, s)
+    return res
+end
+
+"""
+    @memoize func(args...)
+
+Return `func(args...)`, using a persistent cache for the result,
+see [`GAP.cached_call`](@ref).
+
+The key of a call is computed from the pickled arguments, and pickling is
+not canonical for all GAP objects.
+For example, equal groups given by different generators, or with
+different stored attributes, yield different keys,
+thus their results are computed and stored separately.
+The cache is therefore most useful for arguments that are plain data,
+such as integers, strings, and lists of them.
+"""
+macro memoize(ex)
+    Meta.isexpr(ex, :call) || error("@memoize expects a function call")
+    any(a -> Meta.isexpr(a, :parameters) || Meta.isexpr(a, :kw), ex.args[2:end]) &&
+        error("@memoize does not support keyword arguments")
+    return esc(:($cached_call($(ex.args[1]), $(ex.args[2:end]...))))
+end
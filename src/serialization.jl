@@ -0,0 +1,107 @@
+#############################################################################
+##
+##  This file is part of GAP.jl, a bidirectional interface between Julia and
+##  the GAP computer algebra system.
+##
+##  Copyright of GAP.jl and its parts belongs to its developers.
+##  Please refer to its README.md file for details.
+##
+##  SPDX-License-Identifier: LGPL-3.0-or-later
+##
+
+## Binary serialization of GAP objects.
+##
+## The encoding is done by JuliaInterface (see `serialize.c` there),
+## which returns it as a GAP string. On the Julia side, this string is
+## written to the stream with a length prefix, such that several objects
+## can be stored in the same stream.
+
+import Serialization
+
+# Return a GAP string with the serialization of `x`.
+function _serialize_to_string(x::Obj)
+    return GC.@preserve x @ccall JuliaInterface_path.gap_serialize(_JULIA_TO_GAP(x)::Ptr{Cvoid})::GapObj
+end
+
+# Return the GAP object whose serialization is stored in `data`.
+function _deserialize_from_bytes(data::Vector{UInt8})
+    ptr = GC.@preserve data @ccall JuliaInterface_path.gap_deserialize(pointer(data)::Ptr{UInt8}, length(data)::Culong)::Ptr{Cvoid}
+    return _GAP_TO_JULIA(ptr)
+end
+
+"""
+    GAP.serialize(io::IO, x)
+
+Write a binary representation of the GAP object `x` to `io`,
+from which [`GAP.deserialize`](@ref) can recreate `x`.
+
+Supported are integers, rationals, cyclotomics, finite field elements,
+floats, permutations, transformations, partial permutations, booleans,
+characters, strings, plain lists, boolean lists, ranges,
+compressed vectors and matrices over finite fields,
+and records whose components are supported.
+Identical subobjects are written only once,
+thus sharing of subobjects and self-references are preserved.
+For other objects, for example GAP functions, an error is thrown.
+
+The binary format depends on the byte order and word size of the machine.
+
+Julia's `Serialization.serialize` uses this function for GAP objects,
+thus they can also be stored with the functions from the `Serialization`
+module or be sent to other Julia processes.
+
+# Examples
+```jldoctest
+julia> io = IOBuffer();
+
+julia> l = GapObj([1, 2, 3]);  x = GapObj([l, l]);
+
+julia> GAP.serialize(io, x)
+
+julia> seekstart(io);  y = GAP.deserialize(io)
+GAP: [ [ 1, 2, 3 ], [ 1, 2, 3 ] ]
+
+julia> y[1] === y[2]
+true
+```
+"""
+function serialize(io::IO, x::Obj)
+    s = _serialize_to_string(x)
+    GC.@preserve s begin
+        ptr, len = UNSAFE_CSTR_STRING(s)
+        write(io, htol(UInt64(len)))
+        unsafe_write(io, ptr, len)
+    end
+    return nothing
+end
+
+"""
+    GAP.deserialize(io::IO)
+
+Read a GAP object written by [`GAP.serialize`](@ref) from `io`, and return it.
+
+The data are checked before GAP objects are created from them,
+an error is thrown if they are invalid.
+"""
+function deserialize(io::IO)
+    len = Int(ltoh(read(io, UInt64)))
+    data = read(io, len)
+    length(data) == len || throw(EOFError())
+    return _deserialize_from_bytes(data)
+end
+
+function Serialization.serialize(s::Serialization.AbstractSerializer, x::GapObj)
+    Serialization.serialize_type(s, GapObj)
+    serialize(s.io, x)
+end
+
+Serialization.deserialize(s::Serialization.AbstractSerializer, ::Type{GapObj}) =
+    deserialize(s.io)::GapObj
+
+function Serialization.serialize(s::Serialization.AbstractSerializer, x::FFE)
+    Serialization.serialize_type(s, FFE)
+    serialize(s.io, x)
+end
+
+Serialization.deserialize(s::Serialization.AbstractSerializer, ::Type{FFE}) =
+    deserialize(s.io)::FFE
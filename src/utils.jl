@@ -42,6 +42,37 @@ function get_symbols_in_module(m::Module)
     return list
 end
 
+"""
+    JuliaError
+
+An object of this type describes a Julia exception that was caught
+by [`call_with_catch`](@ref).
+It stores the exception in its field `exception`
+and the backtrace of the error in its field `backtrace`.
+
+The error message is computed only on demand,
+via [`error_message`](@ref) or `showerror`.
+"""
+struct JuliaError
+    exception::Any
+    backtrace::Vector
+end
+
+function Base.show(io::IO, e::JuliaError)
+    print(io, "GAP.JuliaError(")
+    show(io, e.exception)
+    print(io, ")")
+end
+
+Base.showerror(io::IO, e::JuliaError) = showerror(io, e.exception, e.backtrace)
+
+"""
+    error_message(e::JuliaError)
+
+Return the string that describes the Julia exception stored in `e`.
+"""
+error_message(e::JuliaError) = sprint(showerror, e.exception)
+
 """
     call_with_catch(func, args::Vector)
     call_with_catch(func, args::Vector, kwargs::Dict{Symbol,T}) where T
@@ -52,7 +83,9 @@ the keys and values of `kwargs`).
 
 Here `ok` is either `true`, meaning that calling `func` returned the value `val`,
 or `false`, meaning that the function call did run into an error.
-In the latter case, `val` is set to the string of the error message.
+In the latter case, `val` is a [`JuliaError`](@ref) object that describes
+the error; no error message is computed unless it is asked for,
+thus `call_with_catch` is cheap also if the call fails.
 
 This function is used on the GAP side.
 
@@ -66,7 +99,10 @@ julia> flag, res = GAP.call_with_catch(sqrt, [-2]);
 julia> flag
 false
 
-julia> startswith(res, "DomainError")
+julia> res.exception isa DomainError
+true
+
+julia> startswith(GAP.error_message(res), "DomainError")
 true
 
 julia> GAP.call_with_catch(range, [2, 10], Dict(:step => 2))
@@ -77,7 +113,7 @@ julia> flag, res = GAP.call_with_catch(range, [2, 10], Dict(:step => "a"));
 julia> flag
 false
 
-julia> startswith(res, "MethodError")
+julia> startswith(GAP.error_message(res), "MethodError")
 true
 ```
 """
@@ -86,7 +122,7 @@ function call_with_catch(func, args)
         res = func(args...)
         return (true, res)
     catch e
-        return (false, string(e))
+        return (false, JuliaError(e, catch_backtrace()))
     end
 end
 
@@ -95,10 +131,13 @@ function call_with_catch(func, args::Vector, kwargs::Dict{Symbol,T}) where T
         res = func(args...; [k => kwargs[k] for k in keys(kwargs)]...)
         return (true, res)
     catch e
-        return (false, string(e))
+        return (false, JuliaError(e, catch_backtrace()))
     end
 end
 
+# This function is used by the JuliaInterface kernel code.
+_julia_exception_message(e) = sprint(showerror, e)
+
 """
     kwarg_wrapper(func, args::Vector{T1}, kwargs::Dict{Symbol,T2}) where {T1, T2}
 
@@ -67,6 +67,7 @@ import GAP: @wrap
 @wrap MakeReadOnlyGlobal(x::Any)::Nothing
 @wrap MakeReadWriteGlobal(x::Any)::Nothing
 @wrap MOD(x::Any, y::Any)::Any
+@wrap NameRNam(x::Int)::GapObj
 @wrap NextIterator(x::Any)::Any
 @wrap NormalizedWhitespace(x::GapObj)::GapObj
 @wrap NumberColumns(x::Any)::GapInt
@@ -90,6 +91,7 @@ import GAP: @wrap
 @wrap StructuralCopy(x::Any)::Any
 @wrap SUM(x::Any, y::Any)::Any
 @wrap UNB_REC(x::GapObj, y::Int)::Nothing
+@wrap Unpack(x::Any)::GapObj
 @wrap ZeroSameMutability(x::Any)::Any
 
 end
@@ -83,6 +83,12 @@
     @test matrix(ZZ, val) == x
     @test map_entries(ZZ, val) == x
 
+    # negative and zero entries
+    x = Nemo.ZZ[-BigInt(2)^65 0; -3 BigInt(2)^130]
+    val = GAP.evalstr( "[ [ -2^65, 0 ], [ -3, 2^130 ] ]" )
+    @test ZZMatrix(val) == x
+    @test matrix(ZZ, val) == x
+
     # matrix containing non-integers
     val = GAP.evalstr( "[ [ 1/2, 2 ], [ 3, 4 ] ]" )
     @test_throws GAP.ConversionError ZZMatrix(val)
@@ -119,6 +125,12 @@
     @test matrix(QQ, val) == x
     @test map_entries(QQ, val) == x
 
+    # negative and zero entries
+    x = Nemo.QQ[-QQFieldElem(ZZRingElem(2)^65, 3) 0; QQFieldElem(-1, 2) 5]
+    val = GAP.evalstr( "[ [ -2^65/3, 0 ], [ -1/2, 5 ] ]" )
+    @test QQMatrix(val) == x
+    @test matrix(QQ, val) == x
+
     # matrix containing non-rationals
     val = GAP.evalstr( "[ [ E(4), 2 ], [ 3, 4 ] ]" )
     @test_throws GAP.ConversionError QQMatrix(val)
@@ -126,3 +138,36 @@
     @test_throws GAP.ConversionError map_entries(QQ, val)
   end
 end
+
+@testset "matrices and vectors over finite fields" begin
+  @testset "$F" for F in [Native.GF(2), Native.GF(5), Native.GF(ZZ(5)), GF(5), GF(3, 2), Native.GF(3, 2), GF(257)]
+    m = matrix(F, 2, 3, [0, 1, -1, 2, 1, 1])
+    x = GapObj(m)
+    @test matrix(F, x) == m
+    @test map_entries(F, x) == m
+    @test matrix(F, GAP.Globals.List(x, GAP.Globals.ShallowCopy)) == m
+    v = [zero(F), one(F), -one(F)]
+    @test map_entries(F, GapObj(v)) == v
+
+    # the entries of the result are not shared with other objects
+    w = map_entries(F, GapObj(v))
+    Nemo.add!(w[2], w[2], one(F))
+    @test map_entries(F, GapObj(v)) == v
+  end
+
+  # entries in a subfield
+  F = GF(3, 2)
+  val = GAP.evalstr("[ [ Z(3), 0*Z(3) ], [ Z(3)^0, Z(3) ] ]")
+  @test matrix(F, val) == matrix(F, [-1 0; 1 -1])
+  val = GAP.evalstr("[ [ Z(3), 0*Z(3) ], [ Z(3)^0, Z(9) ] ]")
+  @test matrix(F, val)[2, 2]^8 == one(F)
+
+  # matrix objects
+  F = Native.GF(5)
+  val = GAP.evalstr("NewMatrix(IsPlistMatrixRep, GF(5), 2, [ Z(5), 0*Z(5), Z(5)^0, Z(5)^2 ])")
+  @test matrix(F, val) == matrix(F, [2 0; 1 4])
+
+  # entries outside the field
+  val = GAP.evalstr("[ [ Z(9) ] ]")
+  @test_throws ErrorException matrix(F, val)
+end
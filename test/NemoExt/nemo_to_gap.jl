@@ -107,6 +107,11 @@ import AbstractAlgebra
     val = GAP.evalstr( "[ [ 1, 2^65 ], [ 3, 4 ] ]" )
     @test GapObj(x) == val
     @test GAP.Obj(x) == val
+
+    # negative and zero entries
+    x = Nemo.ZZ[-BigInt(2)^65 0; -3 BigInt(2)^130]
+    val = GAP.evalstr( "[ [ -2^65, 0 ], [ -3, 2^130 ] ]" )
+    @test GapObj(x) == val
   end
 
   @testset "QQMatrix" begin
@@ -133,6 +138,11 @@ import AbstractAlgebra
     val = GAP.evalstr( "[ [ 2^65/3^40, 2 ], [ 3, 4 ] ]" )
     @test GapObj(x) == val
     @test GAP.Obj(x) == val
+
+    # negative and zero entries
+    x = Nemo.QQ[-QQFieldElem(ZZRingElem(2)^65, 3) 0; QQFieldElem(-1, 2) 5]
+    val = GAP.evalstr( "[ [ -2^65/3, 0 ], [ -1/2, 5 ] ]" )
+    @test GapObj(x) == val
   end
 end
 
@@ -147,3 +157,65 @@ end
     m = matrix(F, 4, 4, 1:16)
     @test GAP.Obj(m) == GAP.evalstr("[ [ Z(5), Z(5)^2, Z(5)^0, Z(5)^3 ], [ 0*Z(5), Z(5), Z(5)^2, Z(5)^0 ], [ Z(5)^3, 0*Z(5), Z(5), Z(5)^2 ], [ Z(5)^0, Z(5)^3, 0*Z(5), Z(5) ] ]")
 end
+
+@testset "matrices and vectors over finite fields" begin
+    # compressed representations
+    F = Native.GF(2)
+    m = matrix(F, [1 0 1; 0 1 1])
+    x = GapObj(m)
+    @test x == GAP.evalstr("[ [ 1, 0, 1 ], [ 0, 1, 1 ] ] * Z(2)")
+    @test GAP.Globals.IsGF2MatrixRep(x)
+    v = F.([1, 1, 0])
+    x = GapObj(v)
+    @test x == GAP.evalstr("[ 1, 1, 0 ] * Z(2)")
+    @test GAP.Globals.IsGF2VectorRep(x)
+
+    F = Native.GF(5)
+    m = matrix(F, [1 2; 3 4])
+    x = GapObj(m)
+    @test x == GAP.evalstr("[ [ 1, 2 ], [ 3, 4 ] ] * Z(5)^0")
+    @test GAP.Globals.Is8BitMatrixRep(x)
+    x = GapObj(F.([0, 4, 2]))
+    @test x == GAP.evalstr("[ 0, 4, 2 ] * Z(5)^0")
+    @test GAP.Globals.Is8BitVectorRep(x)
+
+    # rows that fill more than one block resp. byte
+    F = Native.GF(2)
+    v = F.([i % 3 == 0 ? 1 : 0 for i in 1:100])
+    x = GapObj(v)
+    @test GAP.Globals.IsGF2VectorRep(x)
+    @test GAP.Globals.IsMutable(x)
+    @test map_entries(F, x) == v
+    F = Native.GF(3)
+    m = matrix(F, 2, 7, 1:14)
+    x = GapObj(m)
+    @test GAP.Globals.Is8BitMatrixRep(x)
+    @test GAP.Globals.IsMutable(x)
+    @test x == GAP.evalstr("[ [ 1 .. 7 ], [ 8 .. 14 ] ] * Z(3)^0")
+    @test matrix(F, x) == m
+
+    # more than 256 elements
+    F = GF(257)
+    m = matrix(F, [1 2; 3 256])
+    x = GapObj(m)
+    @test x == GAP.evalstr("[ [ 1, 2 ], [ 3, 256 ] ] * Z(257)^0")
+    @test !GAP.Globals.Is8BitMatrixRep(x)
+
+    # non-prime fields
+    @testset "$F" for F in [GF(3, 2), Native.GF(3, 2)]
+        a = gen(F)
+        m1 = matrix(F, [a 1; 0 a^2])
+        m2 = matrix(F, [1 a; a+1 0])
+        @test GapObj(m1) * GapObj(m2) == GapObj(m1 * m2)
+        @test GapObj(m1) + GapObj(m2) == GapObj(m1 + m2)
+        @test GAP.Globals.Is8BitMatrixRep(GapObj(m1))
+        @test GapObj([a, one(F)]) == GapObj(m1)[1]
+        m = matrix(F, [a^k for i in 1:3, k in 0:7])
+        @test all(GapObj(m)[i] == GapObj([m[i, j] for j in 1:8]) for i in 1:3)
+    end
+
+    # empty matrices
+    F = Native.GF(5)
+    @test GapObj(zero_matrix(F, 0, 3)) == GAP.evalstr("[]")
+    @test GapObj(zero_matrix(F, 2, 0)) == GAP.evalstr("[ [], [] ]")
+end
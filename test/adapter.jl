@@ -87,3 +87,11 @@ end
     print(ioc, GapObj)
     @test String(take!(io)) == "GAP.GapObj"
 end
+
+@testset "record access for Julia objects" begin
+    getbar = GAP.evalstr("obj -> obj.bar")
+    @test getbar((bar = 1,)) == 1
+    # invalid record name numbers are rejected
+    f = GAP.evalstr("obj -> \\.( obj, 10^9 )")
+    @test_throws ErrorException f((bar = 1,))
+end
@@ -83,6 +83,37 @@ end
     @test !hasproperty(GAP.Globals, :foobar)
 
     @test string(GAP.Globals) == "\"table of global GAP objects\""
+
+    # the index of names is updated when new GAP variables get created
+    names = propertynames(GAP.Globals)
+    @test !(:foobar_index_test in names)
+    @test !hasproperty(GAP.Globals, :foobar_index_test)
+    @test isempty(GAP.global_names_with_prefix("foobar_index_te"))
+    GAP.Globals.foobar_index_test = 1
+    @test hasproperty(GAP.Globals, :foobar_index_test)
+    @test :foobar_index_test in propertynames(GAP.Globals)
+    @test GAP.global_names_with_prefix("foobar_index_te") == ["foobar_index_test"]
+    @test length(propertynames(GAP.Globals)) == GAP.Globals.Length(GAP.Globals.NamesGVars())
+    @test issorted(GAP._GLOBAL_NAMES.sorted)
+    @test GAP._merge_sorted(["a", "c"], ["b", "d", "e"]) == ["a", "b", "c", "d", "e"]
+
+    # checking for an unknown name creates no GAP variable
+    n = GAP.Globals.Length(GAP.Globals.NamesGVars())
+    @test !hasproperty(GAP.Globals, :foobar_index_unknown)
+    @test GAP.Globals.Length(GAP.Globals.NamesGVars()) == n
+    l = GAP.global_names_with_prefix("Size")
+    @test "Size" in l && "SizeScreen" in l
+    @test all(startswith("Size"), l) && issorted(l)
+    @test length(l) == count(startswith("Size") ∘ string, propertynames(GAP.Globals))
+
+    # new names are found also if the variables fill more than one of
+    # GAP's buckets of names
+    for i in 1:1100
+        GAP.Globals.BindGlobal(GapObj("foobar_bucket_$i"), i)
+        i % 100 == 0 && @test hasproperty(GAP.Globals, Symbol("foobar_bucket_$i"))
+    end
+    @test length(GAP.global_names_with_prefix("foobar_bucket_")) == 1100
+    @test map(string, propertynames(GAP.Globals)) == Vector{String}(GAP.Globals.NamesGVars())
 end
 
 @testset "gapcalls" begin
@@ -158,6 +189,52 @@ end
     @test GapObj([1, 2, 3, 4, 5, 6, 7]) == f(1, 2, 3, 4, 5, 6, 7)
 end
 
+@testset "Julia errors in GAP calls" begin
+    ok, res = GAP.call_with_catch(sqrt, [4])
+    @test ok && res == 2.0
+    ok, res = GAP.call_with_catch(sqrt, [-1])
+    @test !ok
+    @test res isa GAP.JuliaError
+    @test res.exception isa DomainError
+    @test !isempty(res.backtrace)
+    @test startswith(GAP.error_message(res), "DomainError")
+    @test startswith(sprint(showerror, res), "DomainError")
+    @test startswith(sprint(show, res), "GAP.JuliaError(DomainError")
+
+    # Julia errors that get turned into GAP errors
+    @test_throws "Error thrown by GAP: Error, a Julia error" GAP.Globals.JuliaEvalString(GapObj("error(\"a Julia error\")"))
+    @test GAP.Globals.TryCallJuliaFunction(sqrt, GapObj([-1]))[1] == false
+end
+
+@testset "timeouts and cancellation" begin
+    loop = GAP.evalstr("function() local i; i:= 0; while true do i:= i+1; od; end")
+
+    @test GAP.with_timeout(() -> GAP.Globals.Factorial(10), 10) == 3628800
+    @test_throws GAP.InterruptedError GAP.with_timeout(loop, 0.1)
+    @test_throws ArgumentError GAP.with_timeout(loop, 0)
+
+    # other errors are passed through
+    @test_throws ErrorException GAP.with_timeout(() -> GAP.Globals.Error(), 10)
+
+    # GAP is usable after an interrupt
+    @test GAP.Globals.Factorial(10) == 3628800
+    @test GAP.evalstr("1+1") == 2
+
+    token = GAP.CancellationToken()
+    @test !GAP.is_cancelled(token)
+    @test GAP.with_cancellation(() -> GAP.Globals.Factorial(10), token) == 3628800
+    if Threads.nthreads() > 1
+        t = Threads.@spawn (sleep(0.1); GAP.cancel!(token))
+        @test_throws GAP.InterruptedError GAP.with_cancellation(loop, token)
+        wait(t)
+    else
+        GAP.cancel!(token)
+    end
+    @test GAP.is_cancelled(token)
+    @test_throws GAP.InterruptedError GAP.with_cancellation(() -> 1, token)
+    @test GAP.Globals.Factorial(10) == 3628800
+end
+
 @testset "bugfixes" begin
     # from issue #324:
     l = GAP.evalstr("[1,~,3]")
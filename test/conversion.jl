@@ -74,6 +74,56 @@
     @test_throws GAP.ConversionError GAP.gap_to_julia(Rational{BigInt}, x)
   end
 
+  @testset "Vectors and matrices of BigInts and rationals" begin
+    x = GAP.evalstr("[ 2^100, -2^70, 0, 1, -1, 2^60 ]")
+    v = [BigInt(2)^100, -BigInt(2)^70, 0, 1, -1, BigInt(2)^60]
+    @test (@inferred GAP.gap_to_julia(Vector{BigInt}, x)) == v
+    @test Vector{BigInt}(x) == v
+    @test Vector{Rational{BigInt}}(x) == v
+    @test Vector{BigInt}(GAP.evalstr("[ 1 .. 3 ]")) == [1, 2, 3]
+    @test_throws GAP.ConversionError Vector{BigInt}(GAP.evalstr("[ 1, 1/2 ]"))
+    @test_throws GAP.ConversionError Vector{BigInt}(GAP.evalstr("[ 1, , 2 ]"))
+
+    x = GAP.evalstr("[ [ 2^100, 1/3 ], [ -5/2^70, 0 ] ]")
+    m = [BigInt(2)^100 1//3; -5//BigInt(2)^70 0]
+    @test (@inferred GAP.gap_to_julia(Matrix{Rational{BigInt}}, x)) == m
+    @test_throws GAP.ConversionError Matrix{BigInt}(x)
+    @test Matrix{BigInt}(GAP.evalstr("[ [ 1, 2^65 ], [ -2^65, 0 ] ]")) == [1 BigInt(2)^65; -BigInt(2)^65 0]
+    @test size(Matrix{BigInt}(GAP.evalstr("[]"))) == (0, 0)
+
+    # in-place conversion reuses the array but not its entries
+    dest = BigInt[BigInt(3)^200, 7]
+    x1 = dest[1]
+    x = GAP.evalstr("[ 2^100, -3, 4 ]")
+    @test GAP.convert!(dest, x) === dest
+    @test dest == [BigInt(2)^100, -3, 4]
+    @test x1 == BigInt(3)^200
+    dest = Matrix{BigInt}(undef, 1, 2)
+    @test GAP.convert!(dest, GAP.evalstr("[ [ 1, -2^80 ] ]")) == [1 -BigInt(2)^80]
+    @test_throws DimensionMismatch GAP.convert!(dest, GAP.evalstr("[ [ 1, 2 ], [ 3, 4 ] ]"))
+    dest = [1 // BigInt(3)]
+    r = dest[1]
+    @test GAP.convert!(dest, GAP.evalstr("[ 5/7, 2^70 ]")) == [5 // 7, BigInt(2)^70]
+    @test r == 1 // 3
+
+    # arrays whose entries are all the same object
+    dest = zeros(BigInt, 3)
+    @test GAP.convert!(dest, GAP.evalstr("[ 1, 2^70, -3 ]")) == [1, BigInt(2)^70, -3]
+    dest = zeros(BigInt, 2, 2)
+    @test GAP.convert!(dest, GAP.evalstr("[ [ 1, 2 ], [ 3, 2^70 ] ]")) == [1 2; 3 BigInt(2)^70]
+    a = BigInt(5)
+    dest = fill(a, 3)
+    @test GAP.convert!(dest, GAP.evalstr("[ 1, 2, 3 ]")) == [1, 2, 3]
+    @test a == 5
+    r = BigInt(1) // 2
+    dest = fill(r, 3)
+    @test GAP.convert!(dest, GAP.evalstr("[ 1/3, 2^70, -4/5 ]")) == [1 // 3, BigInt(2)^70, -4 // 5]
+    @test r == 1 // 2
+    dest = fill(r, 1, 2)
+    @test GAP.convert!(dest, GAP.evalstr("[ [ 1/3, 7 ] ]")) == [1 // 3 7]
+    @test r == 1 // 2
+  end
+
   @testset "Floats" begin
     x = GAP.evalstr("2.")
     @test (@inferred GAP.gap_to_julia(Float64, x)) == 2.0
@@ -247,6 +297,8 @@
     @test_throws ErrorException Set(y)
     @test GAP.gap_to_julia(Set{Int}, GAP.evalstr("[ 1, true ]")) == Set([1, true])
     @test_throws GAP.ConversionError GAP.gap_to_julia(Set{Int}, GAP.evalstr("rec( 1:= 1 )"))
+    @test GAP.gap_to_julia(Set{Int}, GAP.evalstr("[ 3, 1,, 3, 2 ]")) == Set([1, 2, 3])
+    @test GAP.gap_to_julia(Set{String}, GAP.evalstr("[ \"b\", \"a\", \"b\" ]")) == Set(["a", "b"])
   end
 
   @testset "Tuples" begin
@@ -335,6 +387,25 @@
     @test y[:a] == y[:c]
   end
 
+  @testset "NamedTuples" begin
+    x = GAP.evalstr("rec( foo := 1, bar := \"foo\", baz := [ 2, 3 ] )")
+    @test (@inferred GAP.gap_to_julia(NamedTuple{(:foo, :bar),Tuple{Int,String}}, x)) ==
+          (foo = 1, bar = "foo")
+    @test (@inferred NamedTuple{(:bar, :baz),Tuple{Symbol,Tuple{Int,Int}}}(x)) ==
+          (bar = :foo, baz = (2, 3))
+    @test NamedTuple{(:foo, :baz)}(x; recursive = true) == (foo = 1, baz = Any[2, 3])
+    y = NamedTuple{(:foo, :baz)}(x)
+    @test y.baz isa GapObj
+    @test GAP.gap_to_julia(NamedTuple{(),Tuple{}}, x) == NamedTuple()
+    @test_throws ArgumentError GAP.gap_to_julia(NamedTuple{(:foo, :qux),Tuple{Int,Int}}, x)
+    @test_throws GAP.ConversionError GAP.gap_to_julia(NamedTuple{(:foo,),Tuple{Int}}, GapObj([1]))
+
+    x = GAP.evalstr("rec( a:= [ 1, 2 ], c:= ~.a )")
+    y = GAP.gap_to_julia(NamedTuple{(:a, :c),Tuple{Any,Any}}, x; recursive = true)
+    @test y.a isa Vector{Any}
+    @test y.a === y.c
+  end
+
   @testset "Julia Functions" begin
     @test GAP.gap_to_julia(GAP.Globals.Julia.sqrt) === sqrt
     @test_throws GAP.ConversionError GAP.gap_to_julia(Function, 1)
@@ -463,6 +534,24 @@ end
     @test GapObj(-1 // 0) == -GAP.Globals.infinity
   end
 
+  @testset "Vectors and matrices of BigInts and rationals" begin
+    v = [BigInt(2)^100, -BigInt(2)^70, 0, 1, -1, BigInt(2)^60]
+    x = GapObj(v)
+    @test x == GAP.evalstr("[ 2^100, -2^70, 0, 1, -1, 2^60 ]")
+    @test x[4] === 1
+    @test GapObj(BigInt[]) == GAP.evalstr("[]")
+    v = [BigInt(2)^100 // 3, -1 // BigInt(2)^70, 0, 4]
+    @test GapObj(v) == GAP.evalstr("[ 2^100/3, -1/2^70, 0, 4 ]")
+    @test GapObj(Rational{BigInt}[1 // 0, 2]) == GAP.evalstr("[ infinity, 2 ]")
+    m = [BigInt(2)^100 -1; 0 BigInt(3)^50]
+    @test GapObj(m) == GAP.evalstr("[ [ 2^100, -1 ], [ 0, 3^50 ] ]")
+
+    # identical subobjects
+    v = [BigInt(2)^100]
+    x = GapObj([v, v]; recursive = true)
+    @test x[1] === x[2]
+  end
+
   @testset "Floats" begin
     x = GAP.evalstr("2.")
     @test GapObj(2.0) == x
@@ -503,6 +592,27 @@ end
     @test GapObj(Set([4, 3, 1])) == x
     x = GAP.evalstr("[\"a\", \"b\", \"c\"]")
     @test GapObj(Set(["c", "b", "a"]); recursive = true) == x
+    @test GapObj(Set([:c, :b, :a]); recursive = true) == x
+
+    # sets of integers, rationals, and strings are sorted in Julia
+    for s in [Set([3, -1, 2]), Set([big(2)^70, -big(2)^65, big(5)]),
+              Set([1//2, -3//4, 2//1]), Set(["ab", "a", "b", ""]),
+              Set{Int}()]
+      x = GapObj(s; recursive = true)
+      @test GAP.Globals.HasIsSSortedList(x)
+      @test GAP.Globals.IsSSortedList(x)
+      @test x == GapObj(sort!(collect(s)); recursive = true)
+      @test GAP.gap_to_julia(typeof(s), x) == s
+    end
+    x = GapObj(Set([3, -1, 2]))
+    @test GAP.Globals.HasIsSSortedList(x)
+    @test GAP.Globals.IsSSortedList(x)    # the stored value
+    @test x == GAP.evalstr("[ -1, 2, 3 ]")
+
+    # only dense plain lists get marked
+    x = GAP.evalstr("[ 1,, 3 ]")
+    GAP.set_ssorted_plist!(x)
+    @test !GAP.Globals.HasIsSSortedList(x)
 
     for coll in [
       [7, 1, 5, 3, 10],
@@ -576,6 +686,20 @@ end
     @test GapObj(z) == z  # nothing happens without recursion
   end
 
+  @testset "NamedTuples" begin
+    x = GAP.evalstr("rec( foo := 1, bar := \"foo\" )")
+    y = (foo = 1, bar = "foo")
+    z = GAP.evalstr("rec( foo := 1, bar := JuliaEvalString(\"\\\"foo\\\"\") )")
+    @test GapObj(y; recursive = true) == x
+    @test GapObj(y) == z
+    @test GapObj(NamedTuple()) == GAP.evalstr("rec( )")
+
+    v = [1, 2]
+    x = GapObj((a = v, b = v); recursive = true)
+    @test GAP.Globals.IsIdenticalObj(x.a, x.b)
+    @test NamedTuple{(:foo, :bar),Tuple{Int,String}}(GapObj(y; recursive = true)) == y
+  end
+
   @testset "Conversions with identical sub-objects" begin
     l = [1]
     yy = [l, l]
@@ -87,3 +87,54 @@ struct TestType2 X::GapObj end
     @test_throws ErrorException @macroexpand GAP.@install Obj(x::Bool) = x
     @test_throws ErrorException @macroexpand GAP.@install GapObj(x::Bool, y::Bool) = x
 end
+
+GAP.@gaprecord struct TestRecord1
+    x::Int
+    y::String
+end
+
+GAP.@gaprecord struct TestRecord2{T}
+    val::T
+    list::Vector{T}
+end
+
+module GapRecordTestModule
+    import GAP
+    GAP.@gaprecord struct TestRecord3
+        a::Int
+    end
+end
+
+@testset "@gaprecord" begin
+    r = GAP.evalstr("rec( x := 1, y := \"a\", z := 2 )")
+    @test (@inferred GAP.gap_to_julia(TestRecord1, r)) == TestRecord1(1, "a")
+    @test GapObj(TestRecord1(1, "a"); recursive = true) == GAP.evalstr("rec( x := 1, y := \"a\" )")
+    @test GAP.gap_to_julia(TestRecord1, GapObj(TestRecord1(2, "b"); recursive = true)) ==
+          TestRecord1(2, "b")
+    @test_throws ArgumentError GAP.gap_to_julia(TestRecord1, GAP.evalstr("rec( x := 1 )"))
+    @test_throws GAP.ConversionError GAP.gap_to_julia(TestRecord1, GapObj([1, 2]))
+
+    # parametric types
+    r = GAP.evalstr("rec( val := 1, list := [ 2, 3 ] )")
+    x = @inferred GAP.gap_to_julia(TestRecord2{Int}, r)
+    @test x isa TestRecord2{Int}
+    @test x.val == 1 && x.list == [2, 3]
+    @test GapObj(x; recursive = true) == r
+    x = GAP.gap_to_julia(TestRecord2{Rational{Int}}, r)
+    @test x.list == [2//1, 3//1]
+
+    # numbers of record components stored in another session are recomputed
+    names = (:x, :y)
+    ref = Ref{Tuple{UInt,NTuple{2,Int}}}((GAP._session_id[] + 2, (-1, -1)))
+    @test GAP._record_rnams(ref, names) == map(GAP.RNamObj, names)
+    @test ref[] == (GAP._session_id[], map(GAP.RNamObj, names))
+    @test GAP._symbol_of_rnam(GAP._rnam_of_symbol(:x)) === :x
+
+    # the macro can be used in other modules
+    T = GapRecordTestModule.TestRecord3
+    @test GapObj(T(5); recursive = true) == GAP.evalstr("rec( a := 5 )")
+    @test GAP.gap_to_julia(T, GAP.evalstr("rec( a := 6 )")) == T(6)
+
+    @test_throws ErrorException @macroexpand GAP.@gaprecord TestRecord1
+    @test_throws ErrorException @macroexpand GAP.@gaprecord f(x) = x
+end
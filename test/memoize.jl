@@ -0,0 +1,55 @@
+#############################################################################
+##
+##  This file is part of GAP.jl, a bidirectional interface between Julia and
+##  the GAP computer algebra system.
+##
+##  Copyright of GAP.jl and its parts belongs to its developers.
+##  Please refer to its README.md file for details.
+##
+##  SPDX-License-Identifier: LGPL-3.0-or-later
+##
+
+@testset "memoize" begin
+    # do not touch the cache of the user
+    olddir = GAP._memoize_dir[]
+    GAP._memoize_dir[] = mktempdir()
+
+    G = GAP.Globals.SymmetricGroup(5)
+    res = GAP.cached_call(GAP.Globals.IdGroup, G)
+    @test res == GAP.Globals.IdGroup(G)
+
+    # the second call reads the stored value
+    key = GAP._memoize_key(GAP.Globals.IdGroup, (G,))
+    @test key isa String
+    @test isfile(GAP._memoize_path(key))
+    @test startswith(GAP._memoize_path(key), GAP._memoize_dir[])
+    @test GAP.cached_call(GAP.Globals.IdGroup, G) == res
+    @test GAP.@memoize(GAP.Globals.IdGroup(G)) == res
+
+    # different arguments yield different keys
+    @test key != GAP._memoize_key(GAP.Globals.IdGroup, (GAP.Globals.SymmetricGroup(4),))
+    @test key != GAP._memoize_key(GAP.Globals.Size, (G,))
+
+    # a broken cache file is ignored and replaced
+    path = GAP._memoize_path(key)
+    write(path, "garbage")
+    @test GAP.cached_call(GAP.Globals.IdGroup, G) == res
+    @test GAP._memoize_read(path) == res
+
+    # objects that cannot be pickled are not cached
+    x = GapObj([[1, 2]])  # a GAP list containing a Julia object
+    @test GAP._memoize_key(GAP.Globals.IdFunc, (x,)) === nothing
+    @test GAP.cached_call(GAP.Globals.IdFunc, x) === x
+
+    # functions that are not bound to a global variable of their name
+    # are not cached
+    f = GAP.evalstr("x -> x + 1")
+    @test GAP._memoize_key(f, (1,)) === nothing
+    @test GAP.cached_call(f, 1) == 2
+    g = GAP.evalstr("x -> x + 2")
+    GAP.Globals.SetNameFunction(g, GapObj("IdFunc"))
+    @test GAP._memoize_key(g, (1,)) === nothing
+    @test GAP.cached_call(g, 1) == 3
+
+    GAP._memoize_dir[] = olddir
+end
@@ -47,6 +47,15 @@ let s = "GAP.Globals.MTX.IsInd"
     @test s[r] == "IsInd"
 end
 
+# new GAP variables are found
+let s = "GAP.Globals.foobar_compl"
+    c, r = test_complete(s)
+    @test isempty(c)
+    GAP.Globals.foobar_completion_test = 1
+    c, r = test_complete(s)
+    @test c == ["foobar_completion_test"]
+end
+
 # completing a non-record does nothing
 let s = "GAP.Globals.fail."
     c, r = test_complete(s)
@@ -22,6 +22,8 @@ include("conversion.jl")
 include("constructors.jl")
 include("macros.jl")
 include("packages.jl")
+include("memoize.jl")
+include("serialization.jl")
 include("help.jl")
 include("rand.jl")
 
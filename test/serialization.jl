@@ -0,0 +1,137 @@
+#############################################################################
+##
+##  This file is part of GAP.jl, a bidirectional interface between Julia and
+##  the GAP computer algebra system.
+##
+##  Copyright of GAP.jl and its parts belongs to its developers.
+##  Please refer to its README.md file for details.
+##
+##  SPDX-License-Identifier: LGPL-3.0-or-later
+##
+
+import Serialization
+
+function roundtrip(x)
+    io = IOBuffer()
+    GAP.serialize(io, x)
+    seekstart(io)
+    y = GAP.deserialize(io)
+    @test eof(io)
+    return y
+end
+
+@testset "serialization" begin
+    for str in [
+        "0", "-5", "2^100", "-3^80", "2/3", "-(2^70)/7", "E(5)+2*E(5)^2",
+        "Z(2)", "Z(7)^3", "Z(2^5)^7", "0*Z(3^2)", "1.5",
+        "(1,2,3)(4,5)", "(1,70000)", "Transformation([2,3,1,1])",
+        "Transformation(Concatenation([2..70000], [1]))",
+        "PartialPerm([1,3],[5,2])", "PartialPerm([1],[70000])",
+        "true", "false", "fail", "'x'", "\"abc\"", "Immutable(\"abc\")",
+        "[]", "[1,,3]", "[[1,2],[3]]", "Immutable([[1,2],[3]])",
+        "[true,false,true]", "[1..10]", "[3,5..99]",
+        "rec()", "rec(a := 1, b := [2, \"c\"])",
+        "ImmutableVector(GF(2), [Z(2), 0*Z(2), Z(2)])",
+        "ShallowCopy(ImmutableVector(GF(5), [Z(5), Z(5)^2]))",
+        "ImmutableMatrix(GF(2), Z(2) * [[1,0],[0,1]])",
+        "MutableCopyMatrix(ImmutableMatrix(GF(9), Z(9) * [[1,0],[0,1]]))",
+        ]
+        x = GAP.evalstr(str)
+        y = roundtrip(x)
+        @test y == x
+        @test typeof(y) == typeof(x)
+        if x isa GapObj
+            @test GAP.Globals.IsMutable(y) == GAP.Globals.IsMutable(x)
+        end
+    end
+
+    # representations are preserved
+    x = roundtrip(GAP.evalstr("[1..10]"))
+    @test GAP.Globals.IsRangeRep(x)
+    x = roundtrip(GAP.evalstr("BlistList([1..3], [1])"))
+    @test GAP.Globals.IsBlistRep(x)
+    x = roundtrip(GAP.evalstr("ImmutableMatrix(GF(2), Z(2) * [[1,0],[0,1]])"))
+    @test GAP.Globals.IsGF2MatrixRep(x)
+    @test !GAP.Globals.IsMutable(x)
+    x = roundtrip(GAP.evalstr("MutableCopyMatrix(ImmutableMatrix(GF(9), Z(9) * [[1,0],[0,1]]))"))
+    @test GAP.Globals.Is8BitMatrixRep(x)
+    @test GAP.Globals.IsMutable(x)
+    @test GAP.Globals.IsMutable(x[1])
+    x = roundtrip(GAP.evalstr("Set([3,1,2])"))
+    @test GAP.Globals.HasIsSSortedList(x) && GAP.Globals.IsSSortedList(x)
+    x = roundtrip(GAP.evalstr("Set([1, \"a\", (1,2)])"))
+    @test GAP.Globals.HasIsSSortedList(x) && GAP.Globals.IsSSortedList(x)
+    @test !GAP.Globals.IsHomogeneousList(x)
+
+    # sharing and cycles
+    l = GapObj([1, 2])
+    x = roundtrip(GapObj([l, l]))
+    @test x[1] === x[2]
+    x = GAP.evalstr("function() local l; l := [1]; l[2] := l; return l; end")()
+    y = roundtrip(x)
+    @test y[2] === y
+    r = GAP.evalstr("function() local r; r := rec(); r.self := r; return r; end")()
+    y = roundtrip(r)
+    @test y.self === y
+
+    # several objects in one stream
+    io = IOBuffer()
+    GAP.serialize(io, GapObj([1, 2]))
+    GAP.serialize(io, 17)
+    seekstart(io)
+    @test GAP.deserialize(io) == GapObj([1, 2])
+    @test GAP.deserialize(io) == 17
+
+    # unsupported objects and invalid data
+    @test_throws ErrorException GAP.serialize(IOBuffer(), GAP.Globals.Size)
+    @test_throws ErrorException GAP._deserialize_from_bytes(UInt8[1, 2, 3])
+    s = GAP._serialize_to_string(GapObj([1, 2, 3]))
+    data = codeunits(String(s))[1:end-1]
+    @test_throws ErrorException GAP._deserialize_from_bytes(Vector{UInt8}(data))
+
+    # data that violates the invariants of the objects is rejected
+    header = UInt8[codeunits("GJLS")..., 1, sizeof(UInt)]
+    word(x) = reinterpret(UInt8, [Int(x)])
+    intobj(x) = word(4 * x + 1)    # the bits of the GAP small integer `x`
+    smallint(x) = UInt8[1, word(x)...]
+    for data in [
+        UInt8[28],                                  # a hole
+        UInt8[2, 1, word(5)...],                    # unnormalized integer
+        UInt8[3, 2, word(5)..., word(0)...],        # leading zero limb
+        UInt8[4, smallint(1)..., smallint(0)...],   # zero denominator
+        UInt8[4, smallint(2)..., smallint(4)...],   # not reduced
+        UInt8[4, smallint(2)..., smallint(1)...],   # an integer
+        UInt8[4, 28, smallint(2)...],               # hole in a rational
+        UInt8[5, 2, smallint(1)..., 14],            # non-rational coefficient
+        UInt8[6, 4, 1, 1],                          # not a prime field
+        UInt8[8, 2, 0, 0, 5, 0],                    # image exceeds degree
+        UInt8[8, 2, 1, 0, 1, 0],                    # not injective
+        UInt8[10, 2, 0, 0, 2, 0],                   # image exceeds degree
+        UInt8[12, 1, 3, 2, 0],                      # wrong codegree
+        UInt8[12, 2, 1, 1, 0, 1, 0],                # not injective
+        UInt8[12, 2, 1, 1, 0, 0, 0],                # trailing zero image
+        UInt8[18, 2, 2, smallint(2)..., smallint(1)...],  # not sorted
+        UInt8[18, 2, 2, smallint(2)..., 28],        # sorted with a hole
+        UInt8[18, 0, 2, smallint(1)..., 28],        # hole at the end
+        UInt8[18, 4, 0],                            # unknown flag
+        UInt8[20, 0, 3, word(15)...],               # bits beyond the length
+        UInt8[21, 0, 2, word(1)..., word(0)...],    # zero increment
+        UInt8[22, 0, 1, 1, UInt8('a'), 28],         # hole in a record
+        UInt8[23, 0, 16, intobj(3)..., word(15)...],  # bits beyond the length
+        UInt8[23, 0, 16, intobj(200)..., word(0)...], # too short
+        UInt8[24, 0, 5, 24, intobj(2)..., intobj(7)..., word(0)...],  # field
+        UInt8[24, 0, 5, 24, intobj(2)..., intobj(5)..., word(100)...], # byte
+        UInt8[25, 0, 1, 24, 0, 5, 24, intobj(1)..., intobj(5)..., word(0)...],  # row
+        ]
+        @test_throws ErrorException GAP._deserialize_from_bytes([header; data])
+    end
+
+    # hooks for the Serialization module
+    x = GAP.evalstr("[(1,2), rec(a := Z(4)), [1..3]]")
+    io = IOBuffer()
+    Serialization.serialize(io, (x, Z = GAP.Globals.Z(3)))
+    seekstart(io)
+    y = Serialization.deserialize(io)
+    @test y[1] == x
+    @test y.Z == GAP.Globals.Z(3)
+end